@@ -39,8 +39,8 @@ LinkOptions            :=
 IncludePath            :=  $(IncludeSwitch). $(IncludeSwitch). $(IncludeSwitch)../src $(IncludeSwitch)../sqlitewrap $(IncludeSwitch)../linux/Debug $(IncludeSwitch)/usr/include/unittest++ $(IncludeSwitch)/usr/include/UnitTest++ $(IncludeSwitch)../src/sdl2_net $(IncludeSwitch)../src/utf-cpp $(IncludeSwitch)../src/utf8 
 IncludePCH             := 
 RcIncludePath          := 
-Libs                   := $(LibrarySwitch)UnitTest++ $(LibrarySwitch)SqliteWrapped $(LibrarySwitch)sqlite3 $(LibrarySwitch)pthread $(LibrarySwitch)ssl $(LibrarySwitch)crypto $(LibrarySwitch)yaml-cpp $(LibrarySwitch)ssh $(LibrarySwitch)uuid 
-ArLibs                 :=  "libUnitTest++.a" "libSqliteWrapped.a" "sqlite3" "pthread" "ssl" "crypto" "yaml-cpp" "libssh" "uuid" 
+Libs                   := $(LibrarySwitch)UnitTest++ $(LibrarySwitch)SqliteWrapped $(LibrarySwitch)sqlite3 $(LibrarySwitch)pthread $(LibrarySwitch)ssl $(LibrarySwitch)crypto $(LibrarySwitch)yaml-cpp $(LibrarySwitch)ssh $(LibrarySwitch)uuid $(LibrarySwitch)z 
+ArLibs                 :=  "libUnitTest++.a" "libSqliteWrapped.a" "sqlite3" "pthread" "ssl" "crypto" "yaml-cpp" "libssh" "uuid" "z" 
 LibPath                := $(LibraryPathSwitch). $(LibraryPathSwitch). $(LibraryPathSwitch)$(UNIT_TEST_PP_SRC_DIR)/Debug $(LibraryPathSwitch)../linux/Debug $(LibraryPathSwitch)../sqlitewrap $(LibraryPathSwitch)../src 
 
 ##
@@ -61,8 +61,8 @@ AS       := /usr/bin/as
 ##
 CodeLiteDir:=/usr/share/codelite
 Objects0=$(IntermediateDirectory)/src_ansi_processor.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_manager.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_io.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_io.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_access_condition.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_form_manager.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_io_service.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_communicator.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_socket_handler.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_socket_ssh.cpp$(ObjectSuffix) \
-	$(IntermediateDirectory)/src_socket_telnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_encoding.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_access_condition_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_ansi_processor_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_mock_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_conference_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_file_area_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_form_system_config_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_message_area_dao_it.cpp$(ObjectSuffix) \
-	$(IntermediateDirectory)/src_oneliners_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_xrm_test.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_config_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_conference_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_menu_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_file_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_message_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_access_level_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_protocol_dao.cpp$(ObjectSuffix) \
+	$(IntermediateDirectory)/src_socket_telnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_socket_posix.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_encoding.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_access_condition_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_ansi_processor_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_mock_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_conference_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_file_area_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_form_system_config_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_message_area_dao_it.cpp$(ObjectSuffix) \
+	$(IntermediateDirectory)/src_oneliners_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_input_pipeline_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_io_service_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_xrm_test.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_config_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_conference_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_menu_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_file_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_message_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_access_level_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_protocol_dao.cpp$(ObjectSuffix) \
 	$(IntermediateDirectory)/data-sys_security_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_session_stats_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_users_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_text_prompts_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/forms_form_system_config.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-app_oneliners_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetselect.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetTCP.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(ObjectSuffix) \
 	
 
@@ -186,6 +186,14 @@ $(IntermediateDirectory)/src_socket_telnet.cpp$(DependSuffix): ../src/socket_tel
 $(IntermediateDirectory)/src_socket_telnet.cpp$(PreprocessSuffix): ../src/socket_telnet.cpp
 	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_socket_telnet.cpp$(PreprocessSuffix) "../src/socket_telnet.cpp"
 
+$(IntermediateDirectory)/src_socket_posix.cpp$(ObjectSuffix): ../src/socket_posix.cpp $(IntermediateDirectory)/src_socket_posix.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "../src/socket_posix.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_socket_posix.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_socket_posix.cpp$(DependSuffix): ../src/socket_posix.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_socket_posix.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/src_socket_posix.cpp$(DependSuffix) -MM "../src/socket_posix.cpp"
+
+$(IntermediateDirectory)/src_socket_posix.cpp$(PreprocessSuffix): ../src/socket_posix.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_socket_posix.cpp$(PreprocessSuffix) "../src/socket_posix.cpp"
+
 $(IntermediateDirectory)/src_encoding.cpp$(ObjectSuffix): ../src/encoding.cpp $(IntermediateDirectory)/src_encoding.cpp$(DependSuffix)
 	$(CXX) $(IncludePCH) $(SourceSwitch) "../src/encoding.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_encoding.cpp$(ObjectSuffix) $(IncludePath)
 $(IntermediateDirectory)/src_encoding.cpp$(DependSuffix): ../src/encoding.cpp
@@ -274,6 +282,22 @@ $(IntermediateDirectory)/src_session_io_ut.cpp$(DependSuffix): ../xrm-unittest/s
 $(IntermediateDirectory)/src_session_io_ut.cpp$(PreprocessSuffix): ../xrm-unittest/src/session_io_ut.cpp
 	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_session_io_ut.cpp$(PreprocessSuffix) "../xrm-unittest/src/session_io_ut.cpp"
 
+$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(ObjectSuffix): ../xrm-unittest/src/input_pipeline_ut.cpp $(IntermediateDirectory)/src_input_pipeline_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "../xrm-unittest/src/input_pipeline_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(DependSuffix): ../xrm-unittest/src/input_pipeline_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(DependSuffix) -MM "../xrm-unittest/src/input_pipeline_ut.cpp"
+
+$(IntermediateDirectory)/src_input_pipeline_ut.cpp$(PreprocessSuffix): ../xrm-unittest/src/input_pipeline_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_input_pipeline_ut.cpp$(PreprocessSuffix) "../xrm-unittest/src/input_pipeline_ut.cpp"
+
+$(IntermediateDirectory)/src_io_service_ut.cpp$(ObjectSuffix): ../xrm-unittest/src/io_service_ut.cpp $(IntermediateDirectory)/src_io_service_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "../xrm-unittest/src/io_service_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_io_service_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_io_service_ut.cpp$(DependSuffix): ../xrm-unittest/src/io_service_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_io_service_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/src_io_service_ut.cpp$(DependSuffix) -MM "../xrm-unittest/src/io_service_ut.cpp"
+
+$(IntermediateDirectory)/src_io_service_ut.cpp$(PreprocessSuffix): ../xrm-unittest/src/io_service_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_io_service_ut.cpp$(PreprocessSuffix) "../xrm-unittest/src/io_service_ut.cpp"
+
 $(IntermediateDirectory)/src_xrm_test.cpp$(ObjectSuffix): ../xrm-unittest/src/xrm_test.cpp $(IntermediateDirectory)/src_xrm_test.cpp$(DependSuffix)
 	$(CXX) $(IncludePCH) $(SourceSwitch) "../xrm-unittest/src/xrm_test.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_xrm_test.cpp$(ObjectSuffix) $(IncludePath)
 $(IntermediateDirectory)/src_xrm_test.cpp$(DependSuffix): ../xrm-unittest/src/xrm_test.cpp
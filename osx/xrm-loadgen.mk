@@ -0,0 +1,109 @@
+##
+## Auto Generated makefile by CodeLite IDE
+## any manual changes will be erased      
+##
+## Debug
+ProjectName            :=xrm-loadgen
+ConfigurationName      :=Debug
+WorkspacePath          :=/Users/admin/code/Oblivion2-XRM/osx
+ProjectPath            :=/Users/admin/code/Oblivion2-XRM/osx
+IntermediateDirectory  :=./Debug
+OutDir                 := $(IntermediateDirectory)
+CurrentFileName        :=
+CurrentFilePath        :=
+CurrentFileFullPath    :=
+User                   :=Admin
+Date                   :=27/07/2019
+CodeLitePath           :="/Users/admin/Library/Application Support/codelite"
+LinkerName             :=clang++
+SharedObjectLinkerName :=clang++ -shared -fPIC
+ObjectSuffix           :=.o
+DependSuffix           :=
+PreprocessSuffix       :=.o.i
+DebugSwitch            :=-gstab
+IncludeSwitch          :=-I
+LibrarySwitch          :=-l
+OutputSwitch           :=-o 
+LibraryPathSwitch      :=-L
+PreprocessorSwitch     :=-D
+SourceSwitch           :=-c 
+OutputFile             :=$(IntermediateDirectory)/$(ProjectName)
+Preprocessors          :=$(PreprocessorSwitch)TARGET_OS_MAC 
+ObjectSwitch           :=-o 
+ArchiveOutputSwitch    := 
+PreprocessOnlySwitch   :=-E 
+ObjectsFileList        :="xrm-loadgen.txt"
+PCHCompileFlags        :=
+MakeDirCommand         :=mkdir -p
+LinkOptions            :=  
+IncludePath            :=  $(IncludeSwitch). $(IncludeSwitch)../src $(IncludeSwitch)/usr/local/opt/boost/include $(IncludeSwitch)/usr/local/opt/yaml-cpp/include 
+IncludePCH             := 
+RcIncludePath          := 
+Libs                   := $(LibrarySwitch)yaml-cpp 
+ArLibs                 :=  "yaml-cpp" 
+LibPath                := $(LibraryPathSwitch). $(LibraryPathSwitch)/usr/local/opt/boost/lib $(LibraryPathSwitch)/usr/local/opt/yaml-cpp/lib 
+
+##
+## Common variables
+## AR, CXX, CC, AS, CXXFLAGS and CFLAGS can be overriden using an environment variables
+##
+AR       := ar rcus
+CXX      := clang++
+CC       := clang
+CXXFLAGS :=  -Wfatal-errors -g -O0 -pedantic -W -std=c++11 $(Preprocessors)
+CFLAGS   :=  -Wfatal-errors -g -O0 -pedantic -W -std=c++11 $(Preprocessors)
+ASFLAGS  := 
+AS       := llvm-as
+
+
+##
+## User defined environment variables
+##
+CodeLiteDir:=/Applications/codelite.app/Contents/SharedSupport/
+Objects0=$(IntermediateDirectory)/up_xrm-loadgen_src_load_generator.cpp$(ObjectSuffix) 
+
+
+
+Objects=$(Objects0) 
+
+##
+## Main Build Targets 
+##
+.PHONY: all clean PreBuild PrePreBuild PostBuild MakeIntermediateDirs
+all: $(OutputFile)
+
+$(OutputFile): $(IntermediateDirectory)/.d $(Objects) 
+	@$(MakeDirCommand) $(@D)
+	@echo "" > $(IntermediateDirectory)/.d
+	@echo $(Objects0)  > $(ObjectsFileList)
+	$(LinkerName) $(OutputSwitch)$(OutputFile) @$(ObjectsFileList) $(LibPath) $(Libs) $(LinkOptions)
+
+MakeIntermediateDirs:
+	@test -d ./Debug || $(MakeDirCommand) ./Debug
+
+
+$(IntermediateDirectory)/.d:
+	@test -d ./Debug || $(MakeDirCommand) ./Debug
+
+PreBuild:
+	@echo Executing Pre Build commands ...
+	sed -i '' 's+/Users/admin/code/Oblivion2-XRM/+../+' xrm-loadgen.mk
+	@echo Done
+
+
+##
+## Objects
+##
+$(IntermediateDirectory)/up_xrm-loadgen_src_load_generator.cpp$(ObjectSuffix): ../xrm-loadgen/src/load_generator.cpp 
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/Users/admin/code/Oblivion2-XRM/xrm-loadgen/src/load_generator.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/up_xrm-loadgen_src_load_generator.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/up_xrm-loadgen_src_load_generator.cpp$(PreprocessSuffix): ../xrm-loadgen/src/load_generator.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/up_xrm-loadgen_src_load_generator.cpp$(PreprocessSuffix) ../xrm-loadgen/src/load_generator.cpp
+
+
+##
+## Clean
+##
+clean:
+	$(RM) -r ./Debug/
+
+
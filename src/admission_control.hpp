@@ -0,0 +1,215 @@
+#ifndef ADMISSION_CONTROL_HPP
+#define ADMISSION_CONTROL_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class AdmissionControl;
+typedef std::shared_ptr<AdmissionControl> admission_control_ptr;
+
+/**
+ * @class AdmissionTicket
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file admission_control.hpp
+ * @brief Held by an admitted connection, frees it's slot when released.
+ */
+class AdmissionTicket
+{
+public:
+
+    AdmissionTicket(std::weak_ptr<AdmissionControl> admission_control, const std::string &address)
+        : m_admission_control(admission_control)
+        , m_address(address)
+    {
+    }
+
+    ~AdmissionTicket();
+
+private:
+
+    std::weak_ptr<AdmissionControl> m_admission_control;
+    std::string                     m_address;
+};
+
+typedef std::shared_ptr<AdmissionTicket> admission_ticket_ptr;
+
+/**
+ * @class AdmissionControl
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file admission_control.hpp
+ * @brief Checks new connections against max nodes, connections per IP
+ *        And the accept rate before a session is created.  (0 = No Limit)
+ *        Shared by all listeners, so it's Thread Safe.
+ */
+class AdmissionControl
+    : public std::enable_shared_from_this<AdmissionControl>
+{
+public:
+
+    static const int ADMIT_ACCEPTED   = 0;
+    static const int ADMIT_MAX_NODES  = 1;
+    static const int ADMIT_MAX_PER_IP = 2;
+    static const int ADMIT_RATE_LIMIT = 3;
+
+    AdmissionControl(int max_nodes, int max_per_address, int max_accepts_per_second)
+        : m_max_nodes(max_nodes)
+        , m_max_per_address(max_per_address)
+        , m_max_accepts_per_second(max_accepts_per_second)
+        , m_active_nodes(0)
+        , m_tokens(max_accepts_per_second)
+        , m_last_refill(std::chrono::steady_clock::now())
+        , m_address_count()
+        , m_mutex()
+    {
+    }
+
+    /**
+     * @brief Checks the limits, on success a ticket is returned to be held for the connection.
+     * @param address
+     * @param ticket
+     * @return ADMIT_ACCEPTED or the limit reached.
+     */
+    int admit(const std::string &address, admission_ticket_ptr &ticket)
+    {
+        int status = takeSlot(address);
+
+        // Outside the lock, replacing a held ticket releases it's slot.
+        if(status == ADMIT_ACCEPTED)
+        {
+            ticket.reset(new AdmissionTicket(shared_from_this(), address));
+        }
+
+        return status;
+    }
+
+    /**
+     * @brief Frees the slot of a connection that closed.
+     * @param address
+     */
+    void release(const std::string &address)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_active_nodes > 0)
+        {
+            --m_active_nodes;
+        }
+
+        auto it = m_address_count.find(address);
+
+        if(it != m_address_count.end() && --it->second <= 0)
+        {
+            m_address_count.erase(it);
+        }
+    }
+
+    /**
+     * @brief Canned message sent to the caller before the connection is dropped.
+     * @param status
+     * @return
+     */
+    static std::string getRejectionMessage(int status)
+    {
+        switch(status)
+        {
+            case ADMIT_MAX_NODES:
+                return "\r\nAll nodes are busy, please try again later.\r\n";
+
+            case ADMIT_MAX_PER_IP:
+                return "\r\nToo many connections from your address.\r\n";
+
+            case ADMIT_RATE_LIMIT:
+                return "\r\nSystem is busy, please try again in a moment.\r\n";
+
+            default:
+                return "";
+        }
+    }
+
+private:
+
+    /**
+     * @brief Checks the limits, and takes a slot when they all pass.
+     * @param address
+     * @return
+     */
+    int takeSlot(const std::string &address)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_max_nodes > 0 && m_active_nodes >= m_max_nodes)
+        {
+            return ADMIT_MAX_NODES;
+        }
+
+        if(m_max_per_address > 0 && !address.empty())
+        {
+            auto it = m_address_count.find(address);
+
+            if(it != m_address_count.end() && it->second >= m_max_per_address)
+            {
+                return ADMIT_MAX_PER_IP;
+            }
+        }
+
+        // Checked last, so only an admitted connection uses up a token.
+        if(m_max_accepts_per_second > 0)
+        {
+            // Token Bucket, refills at the rate up to one second's worth.
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double>(now - m_last_refill).count();
+            m_last_refill = now;
+            m_tokens += elapsed * m_max_accepts_per_second;
+
+            if(m_tokens > m_max_accepts_per_second)
+            {
+                m_tokens = m_max_accepts_per_second;
+            }
+
+            if(m_tokens < 1.0)
+            {
+                return ADMIT_RATE_LIMIT;
+            }
+
+            m_tokens -= 1.0;
+        }
+
+        ++m_active_nodes;
+
+        if(!address.empty())
+        {
+            ++m_address_count[address];
+        }
+
+        return ADMIT_ACCEPTED;
+    }
+
+    int                                   m_max_nodes;
+    int                                   m_max_per_address;
+    int                                   m_max_accepts_per_second;
+    int                                   m_active_nodes;
+    double                                m_tokens;
+    std::chrono::steady_clock::time_point m_last_refill;
+    std::map<std::string, int>            m_address_count;
+    std::mutex                            m_mutex;
+};
+
+/**
+ * @brief Connection closed, give back the slot.
+ */
+inline AdmissionTicket::~AdmissionTicket()
+{
+    admission_control_ptr admission_control = m_admission_control.lock();
+
+    if(admission_control)
+    {
+        admission_control->release(m_address);
+    }
+}
+
+#endif // ADMISSION_CONTROL_HPP
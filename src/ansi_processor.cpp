@@ -27,6 +27,7 @@ AnsiProcessor::AnsiProcessor(int term_height, int term_width)
     : m_ansi_output("")
     , m_is_screen_cleared(false)
     , m_is_line_wrapping(false)
+    , m_is_clear_pending(false)
     , m_position(0)
     , m_y_position(1)
     , m_number_lines(term_height)
@@ -47,6 +48,8 @@ AnsiProcessor::AnsiProcessor(int term_height, int term_width)
 {
     m_screen_buffer.reserve(m_number_lines * m_characters_per_line);
     m_screen_buffer.resize(m_number_lines * m_characters_per_line);
+    m_shadow_buffer.resize(m_number_lines * m_characters_per_line);
+    m_dirty_rows.resize(m_number_lines, 0);
 }
 
 AnsiProcessor::~AnsiProcessor()
@@ -60,23 +63,43 @@ AnsiProcessor::~AnsiProcessor()
 std::string AnsiProcessor::screenBufferToString()
 {
     m_ansi_output.erase();
-    m_ansi_output = "";
+    m_ansi_output.reserve(m_screen_buffer.size());
 
     for(unsigned int i = 0; i < m_screen_buffer.size(); i++)
     {
         auto &buff = m_screen_buffer[i];
 
-        if(buff.char_sequence[0] == '\r')
-        { } //  character = "\x1b[40m\r\n";
-        else if(buff.char_sequence[0] == '\0')
+        if(buff.code_point == '\0')
             m_ansi_output += " ";
         else
-            m_ansi_output += buff.char_sequence;
+            appendGlyph(buff, m_ansi_output);
     }
 
     return m_ansi_output;
 }
 
+/**
+ * @brief Append a Cell's Glyph as UTF-8, unplotted cells and CR's are skipped.
+ * @param pixel
+ * @param output
+ */
+void AnsiProcessor::appendGlyph(const ScreenPixel &pixel, std::string &output)
+{
+    if(pixel.code_point == '\0' || pixel.code_point == '\r')
+    {
+        return;
+    }
+
+    if(pixel.code_point < 0x80)
+    {
+        output += static_cast<char>(pixel.code_point);
+    }
+    else
+    {
+        utf8::unchecked::append(pixel.code_point, std::back_inserter(output));
+    }
+}
+
 
 /**
  * @brief Test, displays screen buffer.
@@ -89,7 +112,6 @@ void AnsiProcessor::screenBufferDisplayTest()
 
     m_ansi_output.erase();
     m_ansi_output = "";
-    std::string character = "";
 
     if(m_is_screen_cleared)
     {
@@ -123,19 +145,14 @@ void AnsiProcessor::screenBufferDisplayTest()
             ss.ignore();
 
             // buff.c;
-            if(buff.char_sequence[0] == '\r')
-            { } //  character = "\x1b[40m\r\n";
-            else if(buff.char_sequence[0] == '\0')
-                character = " ";
+            if(buff.code_point == '\0')
+                m_ansi_output.append(" ");
             else
-                character = buff.char_sequence;
-
-            m_ansi_output.append(character);
+                appendGlyph(buff, m_ansi_output);
         }
         else
         {
-            character = " ";
-            m_ansi_output.append(character);
+            m_ansi_output.append(" ");
         }
     }
 
@@ -166,9 +183,9 @@ int AnsiProcessor::getMCIOffSet(std::string mci_code)
         // Check for MCI Code, if it matches, return position.
         if(i + 2 < max)
         {
-            if(m_screen_buffer[i].char_sequence[0] == (unsigned char)mci_code[0] &&
-                    m_screen_buffer[i+1].char_sequence[0] == (unsigned char)mci_code[1] &&
-                    m_screen_buffer[i+2].char_sequence[0] == (unsigned char)mci_code[2])
+            if(m_screen_buffer[i].code_point == (unsigned char)mci_code[0] &&
+                    m_screen_buffer[i+1].code_point == (unsigned char)mci_code[1] &&
+                    m_screen_buffer[i+2].code_point == (unsigned char)mci_code[2])
             {
                 return i+1;
             }
@@ -185,9 +202,10 @@ int AnsiProcessor::getMCIOffSet(std::string mci_code)
  */
 std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
 {
-    int attr = 0;
-    int fore = 0;
-    int back = 0;
+    // Unknown at the start, the first color change is always sent in full.
+    int attr = -1;
+    int fore = -1;
+    int back = -1;
 
     // We want to cound \0 characters in a row.
     // These are unplotted so we use home cursor drawing
@@ -195,6 +213,7 @@ std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
     int padding = 0;
 
     std::string ansi_output = "";
+    ansi_output.reserve(m_screen_buffer.size() * 2);
 
     if(clearScreen)
     {
@@ -213,42 +232,33 @@ std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
             break;
         }
 
-        std::stringstream ss;
+        // Color Sequence is only built when it changes.
+        std::string color_sequence = getColorSequence(attr, fore, back, buff);
 
-        if(attr !=  buff.attribute ||
-                fore != buff.foreground ||
-                back != buff.background)
+        if(!color_sequence.empty())
         {
-            ss  << "\x1b["
-                << buff.attribute << ";"
-                << buff.foreground << ";"
-                << buff.background << "m";
-
             if(padding == 0)
-                ansi_output.append(ss.str());
+                ansi_output.append(color_sequence);
 
             attr = buff.attribute;
             fore = buff.foreground;
             back = buff.background;
         }
 
-        ss.clear();
-        ss.ignore();
-
         // Options and skip null non plotted characters by
         // moving the drawing position forward.
-        if(padding > 0 && buff.char_sequence[0] != '\0')
+        if(padding > 0 && buff.code_point != '\0')
         {
             ansi_output += "\x1b[" + std::to_string(padding) + "C";
             // Get the Color change or first character after padding.
-            ansi_output.append(ss.str());
+            ansi_output.append(color_sequence);
             padding = 0;
         }
 
         if(padding > 0 && (i > 0 && i % m_characters_per_line == 0))
         {
             ansi_output += "\x1b[" + std::to_string(padding) + "C";
-            ansi_output.append(ss.str());
+            ansi_output.append(color_sequence);
             padding = 0;
             ansi_output.append("\x1B[1D\r\n");
         }
@@ -257,9 +267,7 @@ std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
             ansi_output.append("\x1B[1D\r\n");
         }
 
-        if(buff.char_sequence[0] == '\r')
-        { } //  character = "\x1b[40m\r\n";
-        else if(buff.char_sequence[0] == '\0')
+        if(buff.code_point == '\0')
         {
             ++padding;
             ++count;
@@ -267,7 +275,7 @@ std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
         }
         else
         {
-            ansi_output.append(buff.char_sequence);
+            appendGlyph(buff, ansi_output);
         }
 
         ++count;
@@ -279,6 +287,181 @@ std::string AnsiProcessor::getScreenFromBuffer(bool clearScreen)
 }
 
 
+/**
+ * @brief Color Sequence to change from the current attributes to the Cell's.
+ *        Only the colors that differ are sent when the attribute stays the same.
+ *        Pass -1 when the current attributes are unknown.
+ * @param attribute
+ * @param foreground
+ * @param background
+ * @param pixel
+ * @return
+ */
+std::string AnsiProcessor::getColorSequence(int attribute, int foreground, int background, const ScreenPixel &pixel)
+{
+    if(attribute == pixel.attribute &&
+            foreground == pixel.foreground &&
+            background == pixel.background)
+    {
+        return "";
+    }
+
+    // A color of 0 (unplotted) resets everything, so it needs the full sequence.
+    if(attribute == pixel.attribute && pixel.foreground != 0 && pixel.background != 0)
+    {
+        if(foreground == pixel.foreground)
+        {
+            return "\x1b[" + std::to_string(pixel.background) + "m";
+        }
+
+        if(background == pixel.background)
+        {
+            return "\x1b[" + std::to_string(pixel.foreground) + "m";
+        }
+
+        return "\x1b[" + std::to_string(pixel.foreground) + ";" +
+               std::to_string(pixel.background) + "m";
+    }
+
+    return "\x1b[" + std::to_string(pixel.attribute) + ";" +
+           std::to_string(pixel.foreground) + ";" +
+           std::to_string(pixel.background) + "m";
+}
+
+/**
+ * @brief Damaged Cells since the last flush, with the least cursor moves and color changes.
+ *        Only dirty rows are compared with the Shadow Buffer, then it's synced.
+ * @return
+ */
+std::string AnsiProcessor::getScreenDifference()
+{
+    std::string output = "";
+
+    if(m_shadow_buffer.size() != m_screen_buffer.size())
+    {
+        m_shadow_buffer.assign(m_screen_buffer.size(), ScreenPixel());
+        m_is_clear_pending = true;
+    }
+
+    // Cursor and Colors on the client, -1 is unknown.
+    int cursor_x = -1;
+    int cursor_y = -1;
+    int attr = -1;
+    int fore = -1;
+    int back = -1;
+
+    if(m_is_clear_pending)
+    {
+        // Cheaper to clear than to blank out each cell.
+        output.append("\x1b[1;1H\x1b[2J");
+        std::memset(m_shadow_buffer.data(), 0, m_shadow_buffer.size() * sizeof(ScreenPixel));
+        markAllRowsDirty();
+        cursor_x = 1;
+        cursor_y = 1;
+    }
+
+    for(int row = 0; row < (signed)m_dirty_rows.size(); row++)
+    {
+        if(!m_dirty_rows[row])
+        {
+            continue;
+        }
+
+        for(int column = 0; column < m_characters_per_line; column++)
+        {
+            unsigned int index = (row * m_characters_per_line) + column;
+
+            if(index >= m_screen_buffer.size())
+            {
+                break;
+            }
+
+            const ScreenPixel &pixel = m_screen_buffer[index];
+            const ScreenPixel &shadow = m_shadow_buffer[index];
+
+            if(pixel.code_point == shadow.code_point &&
+                    pixel.attribute == shadow.attribute &&
+                    pixel.foreground == shadow.foreground &&
+                    pixel.background == shadow.background)
+            {
+                continue;
+            }
+
+            // Move to the cell, forward on the same row is the shortest.
+            int x_position = column + 1;
+            int y_position = row + 1;
+
+            if(cursor_y == y_position && x_position > cursor_x && cursor_x > 0)
+            {
+                output += "\x1b[" + std::to_string(x_position - cursor_x) + "C";
+            }
+            else if(cursor_y != y_position || cursor_x != x_position)
+            {
+                output += "\x1b[" + std::to_string(y_position) + ";" + std::to_string(x_position) + "H";
+            }
+
+            output.append(getColorSequence(attr, fore, back, pixel));
+            attr = pixel.attribute;
+            fore = pixel.foreground;
+            back = pixel.background;
+
+            // Unplotted cells that were drawn are blanked out.
+            if(pixel.code_point == '\0' || pixel.code_point == '\r')
+            {
+                output += ' ';
+            }
+            else
+            {
+                appendGlyph(pixel, output);
+            }
+
+            // Past the last column the cursor position depends on the terminal.
+            cursor_x = x_position + 1;
+            cursor_y = (x_position < m_characters_per_line) ? y_position : -1;
+        }
+    }
+
+    if(!output.empty())
+    {
+        // Screen should always end with reset.
+        output.append("\x1b[0m");
+    }
+
+    markScreenFlushed();
+    return output;
+}
+
+/**
+ * @brief Client was sent the whole screen, Shadow Buffer is synced and nothing is damaged.
+ */
+void AnsiProcessor::markScreenFlushed()
+{
+    if(m_shadow_buffer.size() != m_screen_buffer.size())
+    {
+        m_shadow_buffer = m_screen_buffer;
+    }
+    else
+    {
+        // Only the damaged rows differ.
+        for(int row = 0; row < (signed)m_dirty_rows.size(); row++)
+        {
+            unsigned int start = row * m_characters_per_line;
+
+            if(!m_dirty_rows[row] || start >= m_screen_buffer.size())
+            {
+                continue;
+            }
+
+            unsigned int length = std::min<unsigned int>(m_characters_per_line, m_screen_buffer.size() - start);
+            std::memcpy(&m_shadow_buffer[start], &m_screen_buffer[start], length * sizeof(ScreenPixel));
+        }
+    }
+
+    std::fill(m_dirty_rows.begin(), m_dirty_rows.end(), 0);
+    m_is_clear_pending = false;
+}
+
+
 /**
  * @brief Build the string for Lightbar coors and colors.
  * @param pulldown_id
@@ -520,7 +703,7 @@ std::string AnsiProcessor::screenBufferParse()
  * @brief Plots Characters on the Screen into the Buffer.
  * @param c
  */
-void AnsiProcessor::screenBufferSetGlyph(std::string char_sequence)
+void AnsiProcessor::screenBufferSetGlyph(const std::string &char_sequence)
 {
     Logging *log = Logging::instance();
 
@@ -542,7 +725,20 @@ void AnsiProcessor::screenBufferSetGlyph(std::string char_sequence)
         m_max_y_position = m_y_position;
     }
 
-    m_screen_pixel.char_sequence = char_sequence;
+    // Glyphs are single, complete UTF-8 sequences from getNextGlyph.
+    if(char_sequence.empty())
+    {
+        m_screen_pixel.code_point = 0;
+    }
+    else if(static_cast<unsigned char>(char_sequence[0]) < 0x80)
+    {
+        m_screen_pixel.code_point = static_cast<unsigned char>(char_sequence[0]);
+    }
+    else
+    {
+        m_screen_pixel.code_point = utf8::unchecked::peek_next(char_sequence.begin());
+    }
+
     m_screen_pixel.x_position = m_x_position;
     m_screen_pixel.y_position = m_y_position;
     m_screen_pixel.attribute  = m_attribute;
@@ -558,6 +754,7 @@ void AnsiProcessor::screenBufferSetGlyph(std::string char_sequence)
         if(m_position < (signed)m_screen_buffer.size())
         {
             m_screen_buffer.at(m_position) = m_screen_pixel;
+            markRowDirty(m_position / m_characters_per_line);
         }
         else
         {
@@ -570,7 +767,7 @@ void AnsiProcessor::screenBufferSetGlyph(std::string char_sequence)
     }
 
     // Clear for next sequences.
-    m_screen_pixel.char_sequence = '\0';
+    m_screen_pixel.code_point = 0;
     m_screen_pixel.x_position = 1;
     m_screen_pixel.y_position = 1;
     m_screen_pixel.attribute  = 0;
@@ -605,19 +802,21 @@ void AnsiProcessor::screenBufferScrollUp()
 
     // This remove the top line to scroll the screen up
     // And follow the SDL Surface!  later on add history for scroll back.
-    try
-    {
-        m_screen_buffer.erase(
-            m_screen_buffer.begin(), m_screen_buffer.begin() + m_characters_per_line);
-    }
-    catch(std::exception &e)
+    std::vector<ScreenPixel>::size_type line_size = m_characters_per_line;
+    std::vector<ScreenPixel>::size_type buffer_size = m_screen_buffer.size();
+
+    if(line_size == 0 || line_size > buffer_size)
     {
-        Logging *log = Logging::instance();
-        log->xrmLog<Logging::ERROR_LOG>("[screenBufferScrollUp] Exception=", e.what(), __LINE__, __FILE__);
+        screenBufferClear();
+        return;
     }
 
-    // Readd The last Line back to the buffer.
-    m_screen_buffer.resize(m_number_lines * m_characters_per_line);
+    markAllRowsDirty();
+
+    // Move the lines up and clear the last one.
+    ScreenPixel *buffer = m_screen_buffer.data();
+    std::memmove(buffer, buffer + line_size, (buffer_size - line_size) * sizeof(ScreenPixel));
+    std::memset(buffer + (buffer_size - line_size), 0, line_size * sizeof(ScreenPixel));
 }
 
 /*
@@ -628,24 +827,30 @@ void AnsiProcessor::screenBufferClearRange(int start, int end)
     int startPosition = ((m_y_position-1) * m_characters_per_line) + (start);
     int endPosition = startPosition + (end - start);
 
-    //std::cout << "start " << start << " end " << end
-    // << std::endl;
-    //std::cout << "startPosition " << startPosition << " endPosition " << endPosition
-    // << std::endl;
+    // Clear out entire line, attributes are kept.
+    if(startPosition < 0)
+    {
+        startPosition = 0;
+    }
+
+    if(endPosition > (signed)m_screen_buffer.size())
+    {
+        endPosition = m_screen_buffer.size();
+    }
 
-    // Clear out entire line.
     for(int i = startPosition; i < endPosition; i++)
     {
-        try
-        {
-            m_screen_buffer[i].char_sequence = '\0';
-        }
-        catch(std::exception &e)
-        {
-            Logging *log = Logging::instance();
-            log->xrmLog<Logging::ERROR_LOG>("[screenBufferClearRange] Exception=", e.what(),
-                                            "start=", start, "end=", end, __LINE__, __FILE__);
-        }
+        m_screen_buffer[i].code_point = 0;
+    }
+
+    for(int i = startPosition; i < endPosition; i += m_characters_per_line)
+    {
+        markRowDirty(i / m_characters_per_line);
+    }
+
+    if(startPosition < endPosition)
+    {
+        markRowDirty((endPosition - 1) / m_characters_per_line);
     }
 }
 
@@ -654,9 +859,14 @@ void AnsiProcessor::screenBufferClearRange(int start, int end)
  */
 void AnsiProcessor::screenBufferClear()
 {
-    // Allocate the Size
-    m_screen_buffer.clear();
+    // Unplotted Cells are all zero.
     m_screen_buffer.resize(m_number_lines * m_characters_per_line);
+    markAllRowsDirty();
+
+    if(!m_screen_buffer.empty())
+    {
+        std::memset(m_screen_buffer.data(), 0, m_screen_buffer.size() * sizeof(ScreenPixel));
+    }
 }
 
 /**
@@ -665,6 +875,7 @@ void AnsiProcessor::screenBufferClear()
 void AnsiProcessor::clearScreen()
 {
     m_is_screen_cleared = true;
+    m_is_clear_pending = true;
     screenBufferClear();
     m_x_position = 1;
     m_y_position = 1;
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 
 /**
  * @class ScreenPixel
@@ -13,18 +14,21 @@
  * @date 10/8/2015
  * @file ansi_processor.hpp
  * @brief Managers Characters and their attributes
+ *        Packed POD Cell, the Glyph is kept as a Unicode Code Point (0 is unplotted)
+ *        and only turned back into UTF-8 on output.  The Screen Buffer is one
+ *        contiguous array, so clearing and scrolling are memset / memmove.
  */
 typedef struct ScreenPixel
 {
-    std::string char_sequence;
-    int x_position;
-    int y_position;
-    int attribute;
-    int foreground;
-    int background;
-    int selected_attribute;
-    int selected_foreground;
-    int selected_background;
+    uint32_t code_point;
+    uint16_t x_position;
+    uint16_t y_position;
+    uint16_t attribute;
+    uint16_t foreground;
+    uint16_t background;
+    uint16_t selected_attribute;
+    uint16_t selected_foreground;
+    uint16_t selected_background;
 
 } ScreenPixel;
 
@@ -46,6 +50,7 @@ public:
 
     bool m_is_screen_cleared;
     bool m_is_line_wrapping;
+    bool m_is_clear_pending;         // Screen was cleared since the last flush.
 
     int m_position;
     int m_y_position;
@@ -66,6 +71,8 @@ public:
 
     ScreenPixel                m_screen_pixel;
     std::vector <ScreenPixel>  m_screen_buffer;
+    std::vector <ScreenPixel>  m_shadow_buffer;     // Screen as the client was last sent it.
+    std::vector <uint8_t>      m_dirty_rows;        // Rows changed since the last flush.
     std::map<int, ScreenPixel> m_pull_down_options;
 
     // ANSI escape sequences
@@ -152,9 +159,30 @@ public:
      */
     std::string getScreenFromBuffer(bool clearScreen);
 
+    /**
+     * @brief Damaged Cells since the last flush, with the least cursor moves and color changes.
+     *        The Shadow Buffer is then in sync with the Screen Buffer.
+     */
+    std::string getScreenDifference();
+
+    /**
+     * @brief Client was sent the whole screen, Shadow Buffer is synced and nothing is damaged.
+     */
+    void markScreenFlushed();
+
+    /**
+     * @brief Color Sequence to change from the current attributes to the Cell's.
+     *        Only the colors that differ are sent when the attribute stays the same.
+     *        Pass -1 when the current attributes are unknown.
+     */
+    static std::string getColorSequence(int attribute, int foreground, int background, const ScreenPixel &pixel);
+
+
+    // Append a Cell's Glyph as UTF-8, unplotted cells and CR's are skipped.
+    static void appendGlyph(const ScreenPixel &pixel, std::string &output);
 
     // Screen Buffer Modifiers
-    void screenBufferSetGlyph(std::string char_sequence);
+    void screenBufferSetGlyph(const std::string &char_sequence);
     void screenBufferScrollUp();
     void screenBufferClearRange(int start, int end);
     void screenBufferClear();
@@ -182,6 +210,23 @@ public:
         return m_number_lines;
     }
 
+private:
+
+    // Flag a row for the next Screen Difference, 0 based.
+    void markRowDirty(int row)
+    {
+        if(row >= 0 && row < (signed)m_dirty_rows.size())
+        {
+            m_dirty_rows[row] = 1;
+        }
+    }
+
+    // Mark all rows for the next Screen Difference.
+    void markAllRowsDirty()
+    {
+        std::fill(m_dirty_rows.begin(), m_dirty_rows.end(), 1);
+    }
+
 };
 
 typedef std::shared_ptr<AnsiProcessor> ansi_process_ptr;
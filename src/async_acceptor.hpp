@@ -38,10 +38,7 @@ public:
     template <typename Protocol, typename Callback>
     void asyncAccept(Protocol protocol, const Callback &callback)
     {
-        // Place Holder is used for template parmeters, string_seq is used in writes
-        // Where the Buffer Place Holder in the above method is used for reads.
-        // nullptr can't be passed as reference for vector
-        std::vector<unsigned char> place_holder;
+        // Place Holder is used for template parmeters, nothing is written.
         std::string string_place_holder;
 
         int service_type = SERVICE_TYPE_NONE;
@@ -59,7 +56,7 @@ public:
             service_type = SERVICE_TYPE_LISTENER_IRC;
         }
 
-        m_io_service.addAsyncJob(place_holder, string_place_holder, m_socket_handler, callback, service_type);
+        m_io_service.addAsyncJob(string_place_holder, m_socket_handler, callback, service_type);
     }
 
 };
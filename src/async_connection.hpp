@@ -6,8 +6,8 @@
 #include "socket_handler.hpp"
 #include "logging.hpp"
 
-#include <vector>
 #include <memory>
+#include <string>
 
 /**
  * @class AsyncConnection
@@ -32,13 +32,15 @@ public:
 
     /**
      * @brief Async Read Callback for IOService Work
-     * @param BufferSequence - populates will data retrieved
-     * @param Callback - returns error code
+     *        Data is read into the socket handler's own reusable buffer.
+     * @param Callback - returns error code and the handle holding data retrieved
      */
-    template <typename BufferSequence, typename Callback>
-    void asyncRead(BufferSequence &buffer, const Callback &callback)
+    template <typename Callback>
+    void asyncRead(const Callback &callback)
     {
-        m_io_service.addAsyncJob(buffer, nullptr, m_socket_handler, callback, SERVICE_TYPE_READ);
+        // Data is kept on the socket handler
+        // So there is no copy of the data into a buffer on each read.
+        m_io_service.addAsyncJob(nullptr, m_socket_handler, callback, SERVICE_TYPE_READ);
     }
 
     /**
@@ -49,11 +51,31 @@ public:
     template <typename StringSequence, typename Callback>
     void asyncWrite(StringSequence string_seq, const Callback &callback)
     {
-        // Place Holder is used for template parmeters, string_seq is used in writes
-        // Where the Buffer Place Holder in the above method is used for reads.
-        // nullptr can't be passed as reference for vector
-        std::vector<unsigned char> place_holder;
-        m_io_service.addAsyncJob(place_holder, string_seq, m_socket_handler, callback, SERVICE_TYPE_WRITE);
+        m_io_service.addAsyncJob(string_seq, m_socket_handler, callback, SERVICE_TYPE_WRITE);
+    }
+
+    /**
+     * @brief Async Compress, sends the MCCP2 start sequence then deflates all output after it.
+     *        Queued in order with writes, so nothing before the sequence is compressed.
+     * @param StringSequence - IAC SB COMPRESS2 IAC SE
+     * @param Callback - returns error code
+     */
+    template <typename StringSequence, typename Callback>
+    void asyncCompress(StringSequence string_seq, const Callback &callback)
+    {
+        m_io_service.addAsyncJob(string_seq, m_socket_handler, callback, SERVICE_TYPE_COMPRESS);
+    }
+
+    /**
+     * @brief Async Dispatch Callback, runs on the IOService thread owning this connection.
+     * @param Callback - returns error code and handle to this connection
+     */
+    template <typename Callback>
+    void asyncDispatch(const Callback &callback)
+    {
+        // Place Holder is used for template parmeters, nothing is read or written.
+        std::string string_place_holder;
+        m_io_service.addAsyncJob(string_place_holder, m_socket_handler, callback, SERVICE_TYPE_DISPATCH);
     }
 
     /**
@@ -64,10 +86,6 @@ public:
     template <typename StringSequence, typename Protocol, typename Callback>
     void asyncConnect(StringSequence string_seq, Protocol protocol, const Callback &callback)
     {
-        // Place Holder is used for template parmeters, string_seq is used in writes
-        // Where the Buffer Place Holder in the above method is used for reads.
-        // nullptr can't be passed as reference for vector
-        std::vector<unsigned char> place_holder;
         int service_type = SERVICE_TYPE_NONE;
 
         if(protocol == "TELNET")
@@ -83,7 +101,7 @@ public:
             service_type = SERVICE_TYPE_CONNECT_IRC;
         }
 
-        m_io_service.addAsyncJob(place_holder, string_seq, m_socket_handler, callback, service_type);
+        m_io_service.addAsyncJob(string_seq, m_socket_handler, callback, service_type);
     }
 
     /**
@@ -94,10 +112,6 @@ public:
     template <typename StringSequence, typename Protocol, typename Callback>
     void asyncHandshake(StringSequence string_seq, Protocol protocol, const Callback &callback)
     {
-        // Place Holder is used for template parmeters, string_seq is used in writes
-        // Where the Buffer Place Holder in the above method is used for reads.
-        // nullptr can't be passed as reference for vector
-        std::vector<unsigned char> place_holder;
         int service_type = SERVICE_TYPE_NONE;
 
         if(protocol == "TELNET")
@@ -113,7 +127,7 @@ public:
             service_type = SERVICE_TYPE_LISTENER_IRC;
         }
 
-        m_io_service.addAsyncJob(place_holder, string_seq, m_socket_handler, callback, service_type);
+        m_io_service.addAsyncJob(string_seq, m_socket_handler, callback, service_type);
     }
 
 };
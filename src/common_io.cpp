@@ -37,7 +37,6 @@
 #include <cctype>
 #include <sstream>
 #include <fstream>
-#include <regex>
 
 #include <utf-cpp/utf8.h>
 
@@ -1250,21 +1249,32 @@ bool CommonIO::fileExists(std::string file_name)
     pathAppend(path);
     path += file_name;
 
-    std::ifstream ifs(path);
+    // Probe without opening the file.
+    struct stat file_status;
+    return stat(path.c_str(), &file_status) == 0 && !S_ISDIR(file_status.st_mode);
+}
+
+/**
+ * Reads in ANSI file into Buffer Only
+ * The cached screen is copied, callers that only read it should use readinAnsiShared().
+ */
+std::string CommonIO::readinAnsi(std::string file_name)
+{
+    screen_buffer_ptr screen = readinAnsiShared(file_name);
 
-    if(!ifs.is_open())
+    if(!screen)
     {
-        return false;
+        return "";
     }
 
-    ifs.close();
-    return true;
+    return *screen;
 }
 
 /**
- * Reads in ANSI file into Buffer Only
+ * Reads in ANSI file, Screens are shared from the Screen Cache
+ * And reloaded when the file changes.
  */
-std::string CommonIO::readinAnsi(std::string file_name)
+screen_buffer_ptr CommonIO::readinAnsiShared(const std::string &file_name)
 {
     std::string path = GLOBAL_TEXTFILE_PATH;
     pathAppend(path);
@@ -1273,32 +1283,7 @@ std::string CommonIO::readinAnsi(std::string file_name)
     Logging *log = Logging::instance();
     log->xrmLog<Logging::DEBUG_LOG>("readinAnsi=", path);
 
-    std::string buff;
-    FILE *fp;
-    int c = 0;
-
-    if((fp = fopen(path.c_str(), "r+")) ==  NULL)
-    {
-        return "";
-    }
-
-    do
-    {
-        c = getc(fp);
-
-        if(c != EOF)
-        {
-            buff += c;
-        }
-    }
-    while(c != EOF);
-
-    fclose(fp);
-
-    // Normalize Line Ending for consistent display to users.
-    std::regex exp("(\\r\\n|\\r|\\n)+");
-    std::string fixed_newlines = std::regex_replace(buff, exp, "\r\n");
-    return Encoding::instance()->utf8Encode(fixed_newlines);
+    return ScreenCache::instance()->getScreen(path);
 }
 
 /**
@@ -1,6 +1,8 @@
 #ifndef COMMONIO_HPP
 #define COMMONIO_HPP
 
+#include "screen_cache.hpp"
+
 #include <ctime>
 #include <iostream>
 #include <string>
@@ -124,6 +126,15 @@ public:
      */
     std::string parseInput(const std::string &character_buffer);
 
+    /**
+     * @brief ParseInput is in the middle of an ESC Sequence.
+     * @return
+     */
+    bool isEscapeSequencePending() const
+    {
+        return m_is_escape_sequence || !m_string_buffer.empty();
+    }
+
     /**
     * @brief Returns the InputFieldBuffer
     * @return
@@ -178,11 +189,19 @@ public:
 
     /**
      * @brief Reads in Ansi file into Buffer Only
+     *        Returns a copy of the cached screen, for callers that edit it.
      * @param FileName
      * @return
      */
     std::string readinAnsi(std::string file_name);
 
+    /**
+     * @brief Reads in Ansi file, the cached screen is shared and not copied.
+     * @param file_name
+     * @return nullptr if the file can't be read.
+     */
+    screen_buffer_ptr readinAnsiShared(const std::string &file_name);
+
     /**
      * @brief Split Strings by delimiter into Vector of Strings.
      * @param s
@@ -7,6 +7,7 @@
 
 #include "safe_queue.hpp"
 #include "session_manager.hpp"
+#include "node_allocator.hpp"
 #include "common_io.hpp"
 
 #include <algorithm>
@@ -93,47 +94,22 @@ public:
     }
 
     /**
-     * @brief Searchs and picks first free node number not in use.
+     * @brief Picks the lowest free node number not in use.
      * @return
      */
     int getNodeNumber()
     {
-        std::lock_guard<std::mutex> lock(m_node_mutex);
-        int node = 1;
-
-        while(1)
-        {
-            auto it = std::find(m_node_array.begin(), m_node_array.end(), node);
-
-            if(it != m_node_array.end())
-            {
-                // Found, try next.
-                ++node;
-            }
-            else
-            {
-                // Not Found, Use This
-                m_node_array.push_back(node);
-                return node;
-            }
-        }
+        return m_node_allocator.allocate();
     }
 
     /**
-     * @brief Removes a Node number from array on disconnect.
+     * @brief Frees a Node number on disconnect.
      * @param int_to_remove
      * @return
      */
     void freeNodeNumber(int int_to_remove)
     {
-        std::lock_guard<std::mutex> lock(m_node_mutex);
-        auto it = std::find(m_node_array.begin(), m_node_array.end(), int_to_remove);
-
-        if(it != m_node_array.end())
-        {
-            std::swap(*it, m_node_array.back());
-            m_node_array.pop_back();
-        }
+        m_node_allocator.release(int_to_remove);
     }
 
     /**
@@ -176,6 +152,8 @@ public:
         // Create Mapping to pass for file creation (default values)
         M_TextPrompt value;
         value[GLOBAL_PROMPT_PAUSE] = std::make_pair("Displayed for Pause Prompts", "|03Hit any Key |08-- |03OBV/2 XRM");
+        value[GLOBAL_PROMPT_IDLE_WARNING] = std::make_pair("Displayed before an Idle Disconnect", "|CR|12Are you still there? |03Hit a key or you will be disconnected.|CR");
+        value[GLOBAL_PROMPT_IDLE_TIMEOUT] = std::make_pair("Displayed on Idle Disconnect", "|CR|12Inactivity timeout, |03disconnecting.|CR");
 
         m_text_prompts_dao->writeValue(value);
     }
@@ -215,12 +193,11 @@ private:
     bool                   m_active;
     config_ptr             m_config;
 
-    mutable std::mutex     m_node_mutex;
     mutable std::mutex     m_data_mutex;
     mutable std::mutex     m_config_mutex;
     mutable std::mutex     m_prompt_mutex;
 
-    std::vector<int>       m_node_array;
+    NodeAllocator          m_node_allocator;
     static Communicator*   m_global_instance;
     CommonIO               m_common_io;
 
@@ -10,7 +10,7 @@
 #include <cassert>
 
 // Setup the file version for the config file.
-const std::string Config::FILE_VERSION = "1.0.4";
+const std::string Config::FILE_VERSION = "1.0.11";
 static bool is_version_displayed = false;
 
 ConfigDao::ConfigDao(config_ptr config, std::string path)
@@ -174,6 +174,20 @@ bool ConfigDao::saveConfig(config_ptr cfg)
     out << YAML::Key << "regexp_email_validation" << YAML::Value << cfg->regexp_email_validation;
     out << YAML::Key << "regexp_email_validation_msg" << YAML::Value << cfg->regexp_email_validation_msg;
     out << YAML::Key << "logging_level" << YAML::Value << cfg->logging_level;
+    out << YAML::Key << "io_service_threads" << YAML::Value << cfg->io_service_threads;
+    out << YAML::Key << "output_high_water_mark" << YAML::Value << cfg->output_high_water_mark;
+    out << YAML::Key << "output_drop_limit" << YAML::Value << cfg->output_drop_limit;
+    out << YAML::Key << "max_nodes" << YAML::Value << cfg->max_nodes;
+    out << YAML::Key << "max_connections_per_ip" << YAML::Value << cfg->max_connections_per_ip;
+    out << YAML::Key << "max_accepts_per_second" << YAML::Value << cfg->max_accepts_per_second;
+    out << YAML::Key << "mccp_compression_level" << YAML::Value << cfg->mccp_compression_level;
+    out << YAML::Key << "mccp_memory_limit_kb" << YAML::Value << cfg->mccp_memory_limit_kb;
+    out << YAML::Key << "logon_timeout_minutes" << YAML::Value << cfg->logon_timeout_minutes;
+    out << YAML::Key << "idle_warning_seconds" << YAML::Value << cfg->idle_warning_seconds;
+    out << YAML::Key << "keepalive_seconds" << YAML::Value << cfg->keepalive_seconds;
+    out << YAML::Key << "screen_cache_kb" << YAML::Value << cfg->screen_cache_kb;
+    out << YAML::Key << "use_listener_reuse_port" << YAML::Value << cfg->use_listener_reuse_port;
+    out << YAML::Key << "use_posix_sockets" << YAML::Value << cfg->use_posix_sockets;
 
     out << YAML::EndMap;
 
@@ -318,6 +332,20 @@ void ConfigDao::encode(const Config &rhs)
     m_config->regexp_email_validation = rhs.regexp_email_validation;
     m_config->regexp_email_validation_msg = rhs.regexp_email_validation_msg;
     m_config->logging_level = rhs.logging_level;
+    m_config->io_service_threads = rhs.io_service_threads;
+    m_config->output_high_water_mark = rhs.output_high_water_mark;
+    m_config->output_drop_limit = rhs.output_drop_limit;
+    m_config->max_nodes = rhs.max_nodes;
+    m_config->max_connections_per_ip = rhs.max_connections_per_ip;
+    m_config->max_accepts_per_second = rhs.max_accepts_per_second;
+    m_config->mccp_compression_level = rhs.mccp_compression_level;
+    m_config->mccp_memory_limit_kb = rhs.mccp_memory_limit_kb;
+    m_config->logon_timeout_minutes = rhs.logon_timeout_minutes;
+    m_config->idle_warning_seconds = rhs.idle_warning_seconds;
+    m_config->keepalive_seconds = rhs.keepalive_seconds;
+    m_config->screen_cache_kb = rhs.screen_cache_kb;
+    m_config->use_listener_reuse_port = rhs.use_listener_reuse_port;
+    m_config->use_posix_sockets = rhs.use_posix_sockets;
 
 }
 
@@ -1,10 +1,9 @@
 #ifndef DEADLINE_TIMER_HPP
 #define DEADLINE_TIMER_HPP
 
-#include "communicator.hpp"
+#include "io_service.hpp"
 
 #include <iostream>
-#include <future>
 #include <thread>
 #include <chrono>
 #include <memory>
@@ -17,26 +16,28 @@
  * @date 17/02/2018
  * @file deadline_timer.hpp
  * @brief Timer class for Wait and AsyncWait.
+ *        Async Waits are scheduled on the IOService's timer wheel.
  */
 class DeadlineTimer
 {
 public:
-    explicit DeadlineTimer()
-        : m_expires_from_now(0)
-        , m_cancellation_token(false)
+    explicit DeadlineTimer(IOService &io_service)
+        : m_io_service(io_service)
+        , m_expires_from_now(0)
+        , m_timer()
     {
     }
 
     ~DeadlineTimer()
     {
-        std::vector<std::future<void>>().swap(m_future_list);
+        cancel();
     }
 
     typedef std::function<void(int)> function_callback;
 
-    int m_expires_from_now;
-    std::atomic_bool m_cancellation_token;
-    std::vector<std::future<void>> m_future_list;
+    IOService       &m_io_service;
+    int              m_expires_from_now;
+    timer_entry_ptr  m_timer;
 
     /**
      * @brief Sets the waiting period for the timer.
@@ -49,48 +50,35 @@ public:
 
     /**
      * @brief Async Non-Block Wait (MilliSeconds) with Callback
+     *        Replaces any wait still pending on this timer.
      * @param callback
      */
     template <typename Callback>
     void asyncWait(const Callback &callback)
     {
-        int i = m_expires_from_now;
-        //std::atomic_bool cancel = &m_cancellation_token;
-        // If one exist, remove and re-create it.
-        checkAsyncClean();
-
-        // Add to container to keep in an active scope
-        m_future_list.emplace_back(
-            std::async(std::launch::async, [i, callback, this]()
+        cancel();
+
+        function_callback fncCallBack = callback;
+        m_timer = m_io_service.asyncTimer(m_expires_from_now, [this, fncCallBack]()
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(i));
-            function_callback fncCallBack = callback;
-
-            // If not Canceled, Execute CallBack with a default status, update lateron
-            // Cancel seems to still execute, but i'm thinking we still need to execute
-            // On Double ESC's HITS.
-            if(!m_cancellation_token)
-            {
-                fncCallBack(0);
-            }
-        })
-        );
+            // Fired, let go of the entry before the callback can re-arm.
+            // The destructor cancels, so this timer is still alive here.
+            m_timer.reset();
+
+            // Execute CallBack with a default status, update lateron
+            fncCallBack(0);
+        });
     }
 
     /**
-     * @brief Clean any unfinished, or cancels on overwrites with new.
+     * @brief Cancel a pending Async Wait, the callback isn't executed.
      */
-    void checkAsyncClean()
+    void cancel()
     {
-        if(m_future_list.size() > 0)
-        {
-            m_cancellation_token = true;
-            m_future_list.pop_back();
-            m_cancellation_token = false;
-        }
-        else
+        if(m_timer)
         {
-            m_cancellation_token = false;
+            m_timer->cancel();
+            m_timer.reset();
         }
     }
 
@@ -31,6 +31,9 @@ const std::string Encoding::ENCODING_TEXT_CP437 = "CP437";
 
 static std::map<wchar_t, uint8_t> map_wide_to_cp437;
 
+// CP437 -> UTF-8 Byte Sequences, built from the table below.
+static std::string cp437_to_utf8[256];
+
 // UCS2 Table Taranslations.
 wchar_t CP437_TABLE[] =
 {
@@ -81,10 +84,40 @@ wchar_t CP437_TABLE[] =
 
 Encoding::Encoding()
 {
+    // Set once at startup, the locale is process wide and
+    // isn't safe to change while the IO Loops are running.
+    std::setlocale(LC_ALL, Encoding::ENCODING_TEXT_UTF8.c_str());
+    std::cout.imbue(std::locale());
+
     // Populate UCS to CP437 Translation Back Mapping.
     for(unsigned int char_value = 0; char_value < 256; char_value++)
     {
         map_wide_to_cp437.insert(std::make_pair(CP437_TABLE[char_value], char_value));
+
+        // Table is all UCS2, at most 3 byte UTF-8 Sequences.
+        unsigned int code_point = static_cast<unsigned int>(CP437_TABLE[char_value]);
+        std::string &sequence = cp437_to_utf8[char_value];
+
+        if(code_point == 0)
+        {
+            // Null Characters are excluded, same as Wide -> multibyte.
+            continue;
+        }
+        else if(code_point < 0x80)
+        {
+            sequence += static_cast<char>(code_point);
+        }
+        else if(code_point < 0x800)
+        {
+            sequence += static_cast<char>(0xC0 | (code_point >> 6));
+            sequence += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else
+        {
+            sequence += static_cast<char>(0xE0 | (code_point >> 12));
+            sequence += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            sequence += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
     }
 }
 
@@ -187,9 +220,6 @@ std::string Encoding::wide_to_multibyte(const std::wstring& wstr)
  */
 std::wstring Encoding::multibyte_to_wide(const char* mbstr)
 {
-    std::setlocale(LC_ALL, Encoding::ENCODING_TEXT_UTF8.c_str());
-    std::cout.imbue(std::locale());
-
     std::wstring result = L"";
     std::mbstate_t state = std::mbstate_t();
     std::size_t len = 1 + std::mbsrtowcs(NULL, &mbstr, 0, &state);
@@ -210,9 +240,6 @@ std::wstring Encoding::multibyte_to_wide(const char* mbstr)
  */
 std::string Encoding::wide_to_multibyte(const std::wstring &wide_string)
 {
-    std::setlocale(LC_ALL, Encoding::ENCODING_TEXT_UTF8.c_str());
-    std::cout.imbue(std::locale());
-
     std::string output = "";
     std::mbstate_t state = std::mbstate_t();
 
@@ -249,27 +276,34 @@ std::string Encoding::wide_to_multibyte(const std::wstring &wide_string)
 std::string Encoding::utf8Encode(const std::string &standard_string)
 {
     std::string output = "";
-    std::wstring wide_string = L"";
-    int ascii_value = 0;
+    output.reserve(standard_string.size());
+    utf8EncodeAppend(standard_string.data(), standard_string.size(), output);
+    return output;
+}
 
-    // Loop and write out after translation to Unicode
-    for(std::string::size_type i = 0; i < standard_string.size(); i++)
+/**
+ * @brief Encode CP437 to UTF-8, appended to the output.
+ *        Table driven, no Wide String conversions.
+ * @param data
+ * @param length
+ * @param output
+ */
+void Encoding::utf8EncodeAppend(const char *data, std::string::size_type length, std::string &output)
+{
+    for(std::string::size_type i = 0; i < length; i++)
     {
-        ascii_value = std::char_traits<char>().to_int_type(standard_string[i]);
+        unsigned char ascii_value = static_cast<unsigned char>(data[i]);
 
-        if(ascii_value < 256)
+        // Printable ASCII is the same in both.
+        if(ascii_value >= 0x20 && ascii_value < 0x7f)
         {
-            wide_string += CP437_TABLE[ascii_value];
+            output += static_cast<char>(ascii_value);
         }
         else
         {
-            Logging *log = Logging::instance();
-            log->xrmLog<Logging::ERROR_LOG>("Error, utf8Encode ascii_value=", ascii_value, __LINE__, __FILE__);
+            output += cp437_to_utf8[ascii_value];
         }
     }
-
-    output += wide_to_multibyte(wide_string);
-    return output;
 }
 
 /**
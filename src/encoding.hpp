@@ -67,6 +67,14 @@ public:
      */
     std::string utf8Encode(const std::string &standard_string);
 
+    /**
+     * @brief Translation from CP437 to UTF-8, appended to the output.
+     * @param data
+     * @param length
+     * @param output
+     */
+    void utf8EncodeAppend(const char *data, std::string::size_type length, std::string &output);
+
     /**
      * @brief Translation from UTF-8 to CP437
      * @param standard_string
@@ -147,6 +147,20 @@ bool FormSystemConfig::onEnter()
     setupBuildOptions("regexp_email_validation", m_config->regexp_email_validation);
     setupBuildOptions("regexp_email_validation_msg", m_config->regexp_email_validation_msg);
     setupBuildOptions("logging_level", m_config->logging_level);
+    setupBuildOptions("io_service_threads", m_config->io_service_threads);
+    setupBuildOptions("output_high_water_mark", m_config->output_high_water_mark);
+    setupBuildOptions("output_drop_limit", m_config->output_drop_limit);
+    setupBuildOptions("max_nodes", m_config->max_nodes);
+    setupBuildOptions("max_connections_per_ip", m_config->max_connections_per_ip);
+    setupBuildOptions("max_accepts_per_second", m_config->max_accepts_per_second);
+    setupBuildOptions("mccp_compression_level", m_config->mccp_compression_level);
+    setupBuildOptions("mccp_memory_limit_kb", m_config->mccp_memory_limit_kb);
+    setupBuildOptions("logon_timeout_minutes", m_config->logon_timeout_minutes);
+    setupBuildOptions("idle_warning_seconds", m_config->idle_warning_seconds);
+    setupBuildOptions("keepalive_seconds", m_config->keepalive_seconds);
+    setupBuildOptions("screen_cache_kb", m_config->screen_cache_kb);
+    setupBuildOptions("use_listener_reuse_port", m_config->use_listener_reuse_port);
+    setupBuildOptions("use_posix_sockets", m_config->use_posix_sockets);
     return true;
 }
 
@@ -154,6 +154,20 @@ struct convert<config_ptr>
         node["regexp_date_validation_msg"] = rhs->regexp_date_validation_msg;
         node["regexp_email_validation_msg"] = rhs->regexp_email_validation_msg;
         node["logging_level"] = rhs->logging_level;
+        node["io_service_threads"] = rhs->io_service_threads;
+        node["output_high_water_mark"] = rhs->output_high_water_mark;
+        node["output_drop_limit"] = rhs->output_drop_limit;
+        node["max_nodes"] = rhs->max_nodes;
+        node["max_connections_per_ip"] = rhs->max_connections_per_ip;
+        node["max_accepts_per_second"] = rhs->max_accepts_per_second;
+        node["mccp_compression_level"] = rhs->mccp_compression_level;
+        node["mccp_memory_limit_kb"] = rhs->mccp_memory_limit_kb;
+        node["logon_timeout_minutes"] = rhs->logon_timeout_minutes;
+        node["idle_warning_seconds"] = rhs->idle_warning_seconds;
+        node["keepalive_seconds"] = rhs->keepalive_seconds;
+        node["screen_cache_kb"] = rhs->screen_cache_kb;
+        node["use_listener_reuse_port"] = rhs->use_listener_reuse_port;
+        node["use_posix_sockets"] = rhs->use_posix_sockets;
 
         return node;
     }
@@ -278,6 +292,20 @@ struct convert<config_ptr>
         rhs->regexp_date_validation_msg      = node["regexp_date_validation_msg"].as<std::string>();
         rhs->regexp_email_validation_msg     = node["regexp_email_validation_msg"].as<std::string>();
         rhs->logging_level                   = node["logging_level"].as<std::string>();
+        rhs->io_service_threads              = node["io_service_threads"].as<int>();
+        rhs->output_high_water_mark          = node["output_high_water_mark"].as<int>();
+        rhs->output_drop_limit               = node["output_drop_limit"].as<int>();
+        rhs->max_nodes                       = node["max_nodes"].as<int>();
+        rhs->max_connections_per_ip          = node["max_connections_per_ip"].as<int>();
+        rhs->max_accepts_per_second          = node["max_accepts_per_second"].as<int>();
+        rhs->mccp_compression_level          = node["mccp_compression_level"].as<int>();
+        rhs->mccp_memory_limit_kb            = node["mccp_memory_limit_kb"].as<int>();
+        rhs->logon_timeout_minutes           = node["logon_timeout_minutes"].as<int>();
+        rhs->idle_warning_seconds            = node["idle_warning_seconds"].as<int>();
+        rhs->keepalive_seconds               = node["keepalive_seconds"].as<int>();
+        rhs->screen_cache_kb                 = node["screen_cache_kb"].as<int>();
+        rhs->use_listener_reuse_port         = node["use_listener_reuse_port"].as<bool>();
+        rhs->use_posix_sockets               = node["use_posix_sockets"].as<bool>();
         return true;
     }
 };
@@ -0,0 +1,146 @@
+#ifndef GLYPH_SPAN_HPP
+#define GLYPH_SPAN_HPP
+
+#include "logging.hpp"
+#include "utf-cpp/utf8.h"
+
+#include <string>
+
+/**
+ * @class GlyphSpan
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file glyph_span.hpp
+ * @brief Run of Incoming Input passed from the StateManager to the States.
+ *        Glyphs (Single ASCII Characters or UTF-8 multi-byte sequences)
+ *        are split off as they are read, states that can take a whole
+ *        run of text at once read it with takeTextRun().
+ *        The data isn't copied, it must outlive the span.
+ */
+class GlyphSpan
+{
+public:
+
+    explicit GlyphSpan(const std::string &data)
+        : m_data(data)
+        , m_position(0)
+        , m_is_lone_escape(false)
+    {
+    }
+
+    /**
+     * @brief All Glyphs have been read.
+     * @return
+     */
+    bool empty() const
+    {
+        return m_position >= m_data.size() && !m_is_lone_escape;
+    }
+
+    /**
+     * @brief Input left to read, goes down with every Glyph taken.
+     * @return
+     */
+    std::string::size_type getRemaining() const
+    {
+        return (m_data.size() - m_position) + (m_is_lone_escape ? 1 : 0);
+    }
+
+    /**
+     * @brief Reads the next Glyph
+     * @param glyph - Replaced with the Glyph, reuse it to avoid allocations.
+     * @param is_utf8 - Multi-byte sequence
+     * @return false when empty.
+     */
+    bool next(std::string &glyph, bool &is_utf8)
+    {
+        is_utf8 = false;
+
+        // ESC at the end of input is the ESC key, a Null follows it
+        // so input parsing doesn't wait on the rest of a sequence.
+        if(m_is_lone_escape)
+        {
+            m_is_lone_escape = false;
+            glyph.assign(1, '\0');
+            return true;
+        }
+
+        while(m_position < m_data.size())
+        {
+            unsigned char byte_value = m_data[m_position];
+
+            if(byte_value < 128)
+            {
+                ++m_position;
+                glyph.assign(1, static_cast<char>(byte_value));
+                m_is_lone_escape = (byte_value == '\x1b' && m_position == m_data.size());
+                return true;
+            }
+
+            std::string::const_iterator it = m_data.begin() + m_position;
+            std::string::const_iterator start = it;
+
+            try
+            {
+                // Only gets here on multi-byte sequences.
+                utf8::next(it, m_data.end());
+                glyph.assign(start, it);
+                m_position += (it - start);
+                is_utf8 = true;
+                return true;
+            }
+            catch(utf8::exception &ex)
+            {
+                // Invalid sequence, skip the byte and continue.
+                Logging *log = Logging::instance();
+                log->xrmLog<Logging::ERROR_LOG>("Utf8 Parsing Exception=", ex.what(), __LINE__, __FILE__);
+                ++m_position;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Reads a run of printable text, stops at control characters, ESC or
+     *        an incomplete UTF-8 sequence, which are left for next().
+     * @param text - Replaced with the run
+     * @return false when the next glyph isn't printable text.
+     */
+    bool takeTextRun(std::string &text)
+    {
+        std::string::size_type end = m_position;
+
+        while(end < m_data.size())
+        {
+            unsigned char byte_value = m_data[end];
+
+            if(byte_value < 0x20 || byte_value == 0x7f)
+            {
+                break;
+            }
+
+            ++end;
+        }
+
+        std::string::const_iterator start = m_data.begin() + m_position;
+        std::string::const_iterator valid_end = utf8::find_invalid(start, m_data.begin() + end);
+
+        if(valid_end == start)
+        {
+            return false;
+        }
+
+        text.assign(start, valid_end);
+        m_position += (valid_end - start);
+        return true;
+    }
+
+private:
+
+    const std::string     &m_data;
+    std::string::size_type m_position;
+    bool                   m_is_lone_escape;
+};
+
+#endif // GLYPH_SPAN_HPP
@@ -0,0 +1,115 @@
+#ifndef INPUT_NORMALIZER_HPP
+#define INPUT_NORMALIZER_HPP
+
+#include "encoding.hpp"
+
+#include <cstring>
+#include <string>
+
+/**
+ * @class InputNormalizer
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file input_normalizer.hpp
+ * @brief Second stage of the Input Pipeline, after Telnet Options are parsed out.
+ *        CR and CR\LF are folded to a single LF and CP437 is translated to UTF-8 in
+ *        one pass, text between CR's is copied in bulk.
+ *        Not Thread Safe, one per session.
+ */
+class InputNormalizer
+{
+public:
+
+    InputNormalizer()
+        : m_is_carriage_return(false)
+    {
+    }
+
+    /**
+     * @brief Normalize Text, appended to the output.
+     * @param input - Text with Telnet Options removed.
+     * @param output
+     * @param is_cp437 - Translate CP437 to UTF-8, otherwise the text is already UTF-8.
+     */
+    void normalize(const std::string &input, std::string &output, bool is_cp437)
+    {
+        const char *data = input.data();
+        std::string::size_type length = input.size();
+        std::string::size_type position = 0;
+
+        // Reads of only Telnet Options leave no text, keep a pending CR for the next one.
+        if(length == 0)
+        {
+            return;
+        }
+
+        // CR\LF split between reads, the CR was already passed on as LF.
+        if(m_is_carriage_return && data[0] == '\n')
+        {
+            position = 1;
+        }
+
+        m_is_carriage_return = false;
+        std::string::size_type run_start = position;
+
+        while(position < length)
+        {
+            const char *carriage_return = (const char *)memchr(data + position, '\r', length - position);
+
+            if(!carriage_return)
+            {
+                break;
+            }
+
+            // Windows Console Telnet sends [CR\LF] for ENTER, every CR or CR\LF is passed on as a single LF.
+            position = carriage_return - data;
+            appendRun(data + run_start, position - run_start, output, is_cp437);
+            output += '\n';
+            ++position;
+
+            if(position == length)
+            {
+                // Last byte, drop the LF if it starts the next read.
+                m_is_carriage_return = true;
+            }
+            else if(data[position] == '\n')
+            {
+                ++position;
+            }
+
+            run_start = position;
+        }
+
+        appendRun(data + run_start, length - run_start, output, is_cp437);
+    }
+
+private:
+
+    /**
+     * @brief Bulk copy or translate a run of text.
+     * @param data
+     * @param length
+     * @param output
+     * @param is_cp437
+     */
+    void appendRun(const char *data, std::string::size_type length, std::string &output, bool is_cp437)
+    {
+        if(length == 0)
+        {
+            return;
+        }
+
+        if(is_cp437)
+        {
+            Encoding::instance()->utf8EncodeAppend(data, length, output);
+        }
+        else
+        {
+            output.append(data, length);
+        }
+    }
+
+    bool m_is_carriage_return;
+};
+
+#endif // INPUT_NORMALIZER_HPP
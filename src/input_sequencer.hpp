@@ -0,0 +1,150 @@
+#ifndef INPUT_SEQUENCER_HPP
+#define INPUT_SEQUENCER_HPP
+
+#include <string>
+
+/**
+ * @class InputSequencer
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file input_sequencer.hpp
+ * @brief Incremental VT/ANSI Key Sequence scanner for incoming data.
+ *        Sequences complete in a packet pass straight through, an ESC or
+ *        Sequence cut off at the end of a packet is held until the rest
+ *        arrives, or the ESC deadline passes and it's a lone ESC key.
+ *        Not Thread Safe, used by the session's IOService loop.
+ */
+class InputSequencer
+{
+public:
+
+    // ESC Sequences from Terminals are short, anything longer isn't one.
+    static const int MAX_SEQUENCE_LENGTH = 16;
+
+    InputSequencer()
+        : m_state(STATE_GROUND)
+        , m_sequence_length(0)
+        , m_pending()
+    {
+    }
+
+    /**
+     * @brief Prepends any held input, then holds back an incomplete sequence at the end.
+     * @param data - Parsed Data from the Client, Resolved Input is left in place.
+     * @return True when input is held waiting for the rest of a sequence.
+     */
+    bool resolve(std::string &data)
+    {
+        std::string::size_type scan_from = 0;
+        std::string::size_type sequence_start = 0;
+
+        // Held bytes were already scanned, the state carries on from them.
+        if(!m_pending.empty())
+        {
+            scan_from = m_pending.size();
+            data.insert(0, m_pending);
+            m_pending.clear();
+        }
+
+        for(std::string::size_type i = scan_from; i < data.size(); i++)
+        {
+            unsigned char c = data[i];
+
+            // ESC always starts a new sequence, the previous one is complete.
+            if(c == '\x1b')
+            {
+                m_state = STATE_ESCAPE;
+                m_sequence_length = 1;
+                sequence_start = i;
+                continue;
+            }
+
+            if(m_state == STATE_GROUND)
+            {
+                continue;
+            }
+
+            ++m_sequence_length;
+
+            switch(m_state)
+            {
+                case STATE_ESCAPE:
+                    // ESC [ (CSI) and ESC O (SS3), anything else is Alt+Key.
+                    if(c == '[')
+                    {
+                        m_state = STATE_CSI;
+                    }
+                    else if(c == 'O')
+                    {
+                        m_state = STATE_SS3;
+                    }
+                    else
+                    {
+                        m_state = STATE_GROUND;
+                    }
+
+                    break;
+
+                case STATE_CSI:
+                    // Parameters continue, Linux Console F1-F5 are ESC [ [ A-E
+                    // The Final byte completes the sequence.
+                    if(((c >= '0' && c <= '?') || (c == '[' && m_sequence_length == 3)) &&
+                            m_sequence_length < MAX_SEQUENCE_LENGTH)
+                    {
+                        break;
+                    }
+
+                    m_state = STATE_GROUND;
+                    break;
+
+                case STATE_SS3:
+                default:
+                    m_state = STATE_GROUND;
+                    break;
+            }
+        }
+
+        if(m_state == STATE_GROUND)
+        {
+            return false;
+        }
+
+        m_pending.assign(data, sequence_start, std::string::npos);
+        data.erase(sequence_start);
+        return true;
+    }
+
+    /**
+     * @brief ESC Deadline passed, held input is passed on as is.
+     *        A single ESC left at the end is read as the ESC key.
+     * @param data
+     */
+    void flush(std::string &data)
+    {
+        data.swap(m_pending);
+        m_pending.clear();
+        m_state = STATE_GROUND;
+        m_sequence_length = 0;
+    }
+
+    bool isPending() const
+    {
+        return !m_pending.empty();
+    }
+
+private:
+
+    enum
+    {
+        STATE_GROUND,
+        STATE_ESCAPE,
+        STATE_CSI,
+        STATE_SS3
+    };
+
+    int         m_state;
+    int         m_sequence_length;
+    std::string m_pending;
+};
+
+#endif // INPUT_SEQUENCER_HPP
@@ -8,13 +8,21 @@
 
 // New Rework for SDL2_net and Asyc io.
 #include "io_service.hpp"
+#include "io_service_pool.hpp"
 #include "socket_handler.hpp"
 #include "async_acceptor.hpp"
+#include "admission_control.hpp"
+#include "session_arena.hpp"
 #include "logging.hpp"
 
 // For Startup.
 #include <sdl2_net/SDL_net.hpp>
 #include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#endif
 
 class Interface;
 typedef std::unique_ptr<Interface> interface_ptr;
@@ -31,31 +39,30 @@ class Interface
 
 public:
 
-    /**
-     * @brief Create IO_Service Working thread for socket communications.
-     * @return
-     */
-    std::thread create_thread()
-    {
-        return std::thread([&] { m_io_service.run(); });
-    }
-
     /**
      * @brief Main interface constructor.
-     * @param io_service
+     * @param io_service_pool
      * @param protocol
      * @param port
      * @return
      */
-    Interface(IOService& io_service, std::string protocol, int port)
-        : m_io_service(io_service)
+    Interface(IOServicePool& io_service_pool, std::string protocol, int port)
+        : m_io_service_pool(io_service_pool)
         , m_session_manager(new SessionManager())
-        , m_socket_acceptor(new SocketHandler())
-        , m_async_listener(new AsyncAcceptor(io_service, m_socket_acceptor))
+        , m_admission_control()
+        , m_socket_acceptors()
+        , m_async_listeners()
         , m_protocol(protocol)
+        , m_is_reuse_port(false)
     {
 
         Logging *log = Logging::instance();
+        config_ptr config = TheCommunicator::instance()->getConfiguration();
+
+        m_admission_control.reset(new AdmissionControl(
+                                      config->max_nodes,
+                                      config->max_connections_per_ip,
+                                      config->max_accepts_per_second));
 
         // Startup SDL NET.
         if(SDLNet_Init() == -1)
@@ -68,16 +75,35 @@ public:
         unsigned int num_threads = std::thread::hardware_concurrency();
         log->xrmLog<Logging::INFO_LOG>("concurrent threads supported", num_threads);
 
-        // Start up worker thread of ASIO. We want socket communications in a separate thread.
-        // We only spawn a single thread for IO_Service on start up
-        m_thread = create_thread();
+        // Start up worker threads of ASIO. We want socket communications in separate threads.
+        // Each IO_Service loop runs in it's own thread, sessions are spread across them.
+        m_io_service_pool.run();
+
+#ifdef SO_REUSEPORT
+        // Listener per loop, the kernel spreads new connections across them.
+        m_is_reuse_port = config->use_listener_reuse_port && m_io_service_pool.size() > 1;
+#endif
 
-        // Setup Telnet Server Connection Listener.
-        if(!m_socket_acceptor->createTelnetAcceptor("127.0.0.1", port))
+        // Setup Telnet Server Connection Listener(s).
+        unsigned int num_listeners = m_is_reuse_port ? m_io_service_pool.size() : 1;
+
+        for(unsigned int i = 0; i < num_listeners; i++)
         {
-            log->xrmLog<Logging::ERROR_LOG>("Unable to start Telnet Acceptor");
-            TheCommunicator::instance()->shutdown();
-            return;
+            IOService &io_service = m_is_reuse_port
+                                    ? m_io_service_pool.getService(i)
+                                    : m_io_service_pool.getListenerService();
+
+            socket_handler_ptr socket_acceptor(new SocketHandler());
+
+            if(!socket_acceptor->createTelnetAcceptor("127.0.0.1", port, m_is_reuse_port, config->use_posix_sockets))
+            {
+                log->xrmLog<Logging::ERROR_LOG>("Unable to start Telnet Acceptor");
+                TheCommunicator::instance()->shutdown();
+                return;
+            }
+
+            m_socket_acceptors.push_back(socket_acceptor);
+            m_async_listeners.push_back(acceptor_ptr(new AsyncAcceptor(io_service, socket_acceptor)));
         }
 
         // Setup the communicator to allow rest of program to talk with
@@ -90,8 +116,7 @@ public:
 
     ~Interface()
     {
-        m_io_service.stop();
-        m_thread.join();
+        m_io_service_pool.stop();
         SDLNet_Quit();
     }
 
@@ -102,44 +127,68 @@ public:
     {
         Logging *log = Logging::instance();
         log->xrmLog<Logging::DEBUG_LOG>("Waiting For Connection, Adding Async Job to Listener");
-        m_async_listener->asyncAccept(
-            m_protocol,
-            std::bind(&Interface::handle_accept,
-                      this,
-                      std::placeholders::_1,
-                      std::placeholders::_2));
+
+        for(auto &async_listener : m_async_listeners)
+        {
+            async_listener->asyncAccept(
+                m_protocol,
+                std::bind(&Interface::handle_accept,
+                          this,
+                          &async_listener->m_io_service,
+                          std::placeholders::_1,
+                          std::placeholders::_2));
+        }
     }
 
 private:
 
     /**
      * @brief Callback on connections, creates new sessions
-     * @param new_connection
+     * @param accept_service - loop the listener runs on
      * @param error
+     * @param socket_handler
      */
-    void handle_accept(const std::error_code& error, socket_handler_ptr socket_handler)
+    void handle_accept(IOService *accept_service, const std::error_code& error, socket_handler_ptr socket_handler)
     {
         if(!error)
         {
             Logging *log = Logging::instance();
             log->xrmLog<Logging::DEBUG_LOG>("TCP Connection accepted");
 
-            connection_ptr async_conn(new AsyncConnection(m_io_service, socket_handler));
-
-            // Create DeadlineTimer and attach to new session
-            deadline_timer_ptr deadline_timer(new DeadlineTimer(
-                                                  //m_io_service,
-                                                  //socket_handler
-                                              ));
-
-            // Create the new Session
-            session_ptr new_session = Session::create(m_io_service,
-                                      async_conn,
-                                      deadline_timer,
-                                      m_session_manager);
-
-            // Attach Session to Session Manager.
-            m_session_manager->join(new_session);
+            // Over the limits, send the canned message and drop it before a session is built.
+            admission_ticket_ptr ticket;
+            std::string address = socket_handler->getPeerAddress();
+            int status = m_admission_control->admit(address, ticket);
+
+            if(status != AdmissionControl::ADMIT_ACCEPTED)
+            {
+                log->xrmLog<Logging::INFO_LOG>("Connection rejected by admission control", address, status);
+                std::string message = AdmissionControl::getRejectionMessage(status);
+                socket_handler->sendSocket((unsigned char *)message.c_str(), message.size());
+                socket_handler->close();
+                return;
+            }
+
+            socket_handler->setAdmissionTicket(ticket);
+
+            // Assign the connection to a loop for the life of the session.
+            // With a listener per loop, the connection stays on the loop that accepted it.
+            IOService &io_service = m_is_reuse_port
+                                    ? *accept_service
+                                    : m_io_service_pool.getNextService();
+
+            // Session lifetime objects are allocated from the session's own arena.
+            session_arena_ptr session_arena(new SessionArena());
+            connection_ptr async_conn = makeArenaShared<AsyncConnection>(session_arena, io_service, socket_handler);
+
+            // Session is created on the loop's own thread, so all session
+            // State is only ever touched from the one thread.
+            async_conn->asyncDispatch(
+                std::bind(&Interface::handle_session,
+                          this,
+                          async_conn,
+                          session_arena,
+                          std::placeholders::_1));
         }
         else
         {
@@ -148,12 +197,42 @@ private:
         }
     }
 
-    IOService&          m_io_service;
-    session_manager_ptr m_session_manager;
-    socket_handler_ptr  m_socket_acceptor;
-    acceptor_ptr        m_async_listener;
-    std::string         m_protocol;
-    std::thread         m_thread;
+    /**
+     * @brief Callback on the assigned loop, creates the new session
+     * @param async_conn
+     * @param session_arena
+     * @param error
+     */
+    void handle_session(connection_ptr async_conn, session_arena_ptr session_arena, const std::error_code& error)
+    {
+        if(error)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("Session dispatch failed", error.message());
+            return;
+        }
+
+        // Create DeadlineTimer and attach to new session
+        deadline_timer_ptr deadline_timer = makeArenaShared<DeadlineTimer>(session_arena, async_conn->m_io_service);
+
+        // Create the new Session
+        session_ptr new_session = Session::create(async_conn->m_io_service,
+                                  async_conn,
+                                  deadline_timer,
+                                  m_session_manager,
+                                  session_arena);
+
+        // Attach Session to Session Manager.
+        m_session_manager->join(new_session);
+    }
+
+    IOServicePool&                   m_io_service_pool;
+    session_manager_ptr              m_session_manager;
+    admission_control_ptr            m_admission_control;
+    std::vector<socket_handler_ptr>  m_socket_acceptors;
+    std::vector<acceptor_ptr>        m_async_listeners;
+    std::string                      m_protocol;
+    bool                             m_is_reuse_port;
 
 };
 
@@ -0,0 +1,179 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <memory>
+
+template <class T>
+class IntrusiveList;
+
+/**
+ * @class IntrusiveListHook
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file intrusive_list.hpp
+ * @brief Links carried by each item, an item can be in one list at a time.
+ */
+template <class T>
+class IntrusiveListHook
+{
+public:
+    IntrusiveListHook()
+        : m_list_self()
+        , m_list_prev(nullptr)
+        , m_list_next(nullptr)
+    {}
+
+    bool isLinked() const
+    {
+        return m_list_self != nullptr;
+    }
+
+private:
+
+    friend class IntrusiveList<T>;
+
+    // The list keeps the item alive while it's linked.
+    std::shared_ptr<T> m_list_self;
+    T                 *m_list_prev;
+    T                 *m_list_next;
+};
+
+/**
+ * @class IntrusiveList
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file intrusive_list.hpp
+ * @brief Doubly Linked List through the items own hooks, add and remove are O(1)
+ *        Not Thread Safe, owned by a single IOService loop.
+ */
+template <class T>
+class IntrusiveList
+{
+public:
+    explicit IntrusiveList(void)
+        : m_front(nullptr)
+        , m_back(nullptr)
+        , m_size(0)
+    {}
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    ~IntrusiveList(void)
+    {
+        clear();
+    }
+
+    // Add Item to the back of the list, ignored if already linked.
+    void push_back(std::shared_ptr<T> item)
+    {
+        IntrusiveListHook<T> *hook = item.get();
+
+        if(!item || hook->isLinked())
+        {
+            return;
+        }
+
+        hook->m_list_prev = m_back;
+        hook->m_list_next = nullptr;
+
+        if(m_back)
+        {
+            hook_of(m_back)->m_list_next = item.get();
+        }
+        else
+        {
+            m_front = item.get();
+        }
+
+        m_back = item.get();
+        hook->m_list_self = item;
+        ++m_size;
+    }
+
+    // Unlink an Item, returns the list's reference to it.
+    std::shared_ptr<T> remove(T *item)
+    {
+        IntrusiveListHook<T> *hook = item;
+
+        if(!item || !hook->isLinked())
+        {
+            return std::shared_ptr<T>();
+        }
+
+        if(hook->m_list_prev)
+        {
+            hook_of(hook->m_list_prev)->m_list_next = hook->m_list_next;
+        }
+        else
+        {
+            m_front = hook->m_list_next;
+        }
+
+        if(hook->m_list_next)
+        {
+            hook_of(hook->m_list_next)->m_list_prev = hook->m_list_prev;
+        }
+        else
+        {
+            m_back = hook->m_list_prev;
+        }
+
+        hook->m_list_prev = nullptr;
+        hook->m_list_next = nullptr;
+        --m_size;
+
+        std::shared_ptr<T> self;
+        self.swap(hook->m_list_self);
+        return self;
+    }
+
+    // Clear out the Entire List.
+    void clear(void)
+    {
+        while(m_front)
+        {
+            remove(m_front);
+        }
+    }
+
+    T *front(void) const
+    {
+        return m_front;
+    }
+
+    // Shared reference to a linked item, without unlinking it.
+    static std::shared_ptr<T> get(T *item)
+    {
+        return hook_of(item)->m_list_self;
+    }
+
+    // Grab before removing the current item when iterating.
+    static T *next(T *item)
+    {
+        return hook_of(item)->m_list_next;
+    }
+
+    bool is_empty(void) const
+    {
+        return m_front == nullptr;
+    }
+
+    unsigned long size(void) const
+    {
+        return m_size;
+    }
+
+private:
+
+    static IntrusiveListHook<T> *hook_of(T *item)
+    {
+        return item;
+    }
+
+    T            *m_front;
+    T            *m_back;
+    unsigned long m_size;
+};
+
+#endif // INTRUSIVE_LIST_HPP
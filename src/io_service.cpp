@@ -4,20 +4,69 @@
 #include "logging.hpp"
 
 #include <cstring>
+#include <cerrno>
 #include <string>
 #include <thread>
 #include <chrono>
+#include <set>
 #include <system_error>
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 IOService::IOService()
     : m_is_active(false)
+    , m_output_high_water_mark(0)
+    , m_output_drop_limit(0)
+    , m_compression_level(6)
+    , m_compression_memory_kb(128)
+#ifdef __linux__
+    , m_epoll_fd(-1)
+    , m_wakeup_fd(-1)
+    , m_is_wakeup_pending(false)
+#endif
 {
+#ifdef __linux__
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if(m_epoll_fd != -1 && m_wakeup_fd != -1)
+    {
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = m_wakeup_fd;
+
+        if(epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wakeup_fd, &event) == -1)
+        {
+            close(m_epoll_fd);
+            m_epoll_fd = -1;
+        }
+    }
+
+#endif
 }
 
 IOService::~IOService()
 {
-    m_service_list.clear();
-    m_listener_list.clear();
+    clearJobs();
+
+#ifdef __linux__
+
+    if(m_epoll_fd != -1)
+    {
+        close(m_epoll_fd);
+    }
+
+    if(m_wakeup_fd != -1)
+    {
+        close(m_wakeup_fd);
+    }
+
+#endif
 }
 
 /**
@@ -25,142 +74,485 @@ IOService::~IOService()
  */
 void IOService::checkAsyncListenersForConnections()
 {
-    Logging *log = Logging::instance();
-
     // Timers are not removed each iteration
     // Async stay active until exprired or canceled
     // And wait, will block socket polling for (x) amount of time
-    for(unsigned int i = 0; i < m_listener_list.size(); i++)
+    ServiceBase *next_listener = nullptr;
+
+    for(ServiceBase *listener = m_listener_list.front(); listener != nullptr; listener = next_listener)
     {
-        service_base_ptr listener_work = m_listener_list.get(i);
+        next_listener = m_listener_list.next(listener);
 
-        if(!listener_work || !listener_work->getSocketHandle()->isActive())
+        if(!listener->getSocketHandle()->isActive())
         {
-            m_listener_list.remove(i);
-            --i; // Compensate for item removed.
+            m_listener_list.remove(listener);
             continue;
         }
 
+        executeAcceptJob(m_listener_list.get(listener));
+    }
+}
+
+/**
+ * @brief Schedules a callback on this loop's timer wheel, safe from any thread.
+ * @param milliseconds
+ * @param callback
+ * @return Handle to cancel the timer.
+ */
+timer_entry_ptr IOService::asyncTimer(int milliseconds, TimerEntry::callback_function_handler callback)
+{
+    // Deadline is taken now, so it doesn't matter when the loop picks it up.
+    timer_entry_ptr timer(new TimerEntry(
+                              std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds),
+                              [callback]()
+    {
+        try
+        {
+            callback();
+        }
+        catch(std::exception &ex)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("Exception Async-Timer", ex.what(), __FILE__, __LINE__);
+        }
+    }));
+
+    m_timer_queue.push(timer);
+    wakeup();
+    return timer;
+}
+
+/**
+ * @Brief Always check all timers (Priority each iteration)
+ */
+void IOService::checkPriorityTimers()
+{
+    timer_entry_ptr timer;
+
+    while(m_timer_queue.pop(timer))
+    {
+        m_timer_wheel.schedule(timer);
+    }
+
+    if(!m_timer_wheel.is_empty())
+    {
+        m_timer_wheel.advance(std::chrono::steady_clock::now());
+    }
+}
+
+/**
+ * @brief Sorts a submitted job into the Listener or Standard list.
+ * @param job_work
+ */
+void IOService::addSubmittedJob(service_base_ptr job_work)
+{
+    if(!job_work)
+    {
+        return;
+    }
+
+    if(SERVICE_TIMER(job_work->getServiceType()))
+    {
+        // Timers are scheduled on the wheel with asyncTimer().
+        return;
+    }
+    else if(SERVICE_LISTENER(job_work->getServiceType()))
+    {
+        // Server Connection Listener Job (1) for each Service.
+        m_listener_list.push_back(job_work);
+    }
+    else
+    {
+        // Standard Async Job
+        m_service_list.push_back(job_work);
+    }
+}
+
+/**
+ * @brief Releases all jobs, on the loop's thread after it exits.
+ */
+void IOService::clearJobs()
+{
+    m_submit_queue.clear();
+    m_service_list.clear();
+    m_timer_queue.clear();
+    m_timer_wheel.clear();
+    m_listener_list.clear();
+    m_write_jobs.clear();
+    m_pending_output.clear();
+
+#ifdef __linux__
+    m_read_jobs.clear();
+    m_listener_jobs.clear();
+    m_polled_jobs.clear();
+#endif
+}
+
+/**
+ * @brief Executes the listener callback for each accepted connection.
+ *        Drains the backlog (up to MAX_ACCEPTS_PER_PASS) each time it's ready.
+ * @param listener_work
+ */
+void IOService::executeAcceptJob(service_base_ptr listener_work)
+{
+    Logging *log = Logging::instance();
+
+    for(int i = 0; i < MAX_ACCEPTS_PER_PASS; i++)
+    {
         socket_handler_ptr handler = listener_work->getSocketHandle()->acceptTelnetConnection();
 
-        if(handler != nullptr)
+        if(handler == nullptr)
+        {
+            break;
+        }
+
+        log->xrmLog<Logging::DEBUG_LOG>("async accept - connection created.");
+        std::error_code success_code(0, std::generic_category());
+
+        try
+        {
+            // Admission Control (Max Nodes etc..) is checked in the callback
+            // Before a session is created.
+            listener_work->executeCallback(success_code, handler);
+        }
+        catch(std::exception &ex)
+        {
+            log->xrmLog<Logging::ERROR_LOG>("Exception Async-Accept", ex.what(), __FILE__, __LINE__);
+        }
+    }
+}
+
+/**
+ * @brief Reads into the connection's own buffer, then executes the job callback.
+ *        The callback receives the handle to access the bytes read.
+ * @param job_work
+ */
+void IOService::executeReadJob(service_base_ptr job_work)
+{
+    Logging *log = Logging::instance();
+    socket_handler_ptr handle = job_work->getSocketHandle();
+    int length = handle->recvSocketBuffer();
+
+    if(length < 0)
+    {
+        // Error - Lost Connection
+        log->xrmLog<Logging::ERROR_LOG>("async_read - lost connection!: ", length);
+        handle->setInactive();
+        std::error_code lost_connect_error_code(1, std::system_category());
+        job_work->executeCallback(lost_connect_error_code, nullptr);
+    }
+    else
+    {
+        std::error_code success_code(0, std::generic_category());
+        job_work->executeCallback(success_code, handle);
+    }
+}
+
+/**
+ * @brief Queues a job's string sequence on it's connection, sent on the next flush.
+ * @param job_work
+ */
+void IOService::queueWriteJob(service_base_ptr job_work)
+{
+    job_work->getSocketHandle()->queueOutput(job_work->getOutputBuffer());
+    m_write_jobs.push_back(job_work);
+}
+
+/**
+ * @brief Queues the MCCP2 start sequence as is, then everything after it is compressed.
+ * @param job_work
+ */
+void IOService::queueCompressJob(service_base_ptr job_work)
+{
+    socket_handler_ptr handle = job_work->getSocketHandle();
+    handle->queueOutput(job_work->getOutputBuffer());
+
+    if(!handle->startCompression(m_compression_level, m_compression_memory_kb))
+    {
+        // Client is expecting a compressed stream, drop it rather then send garbage.
+        handle->setInactive();
+    }
+
+    m_write_jobs.push_back(job_work);
+}
+
+/**
+ * @brief Sends all queued output (once per connection), then executes the job callbacks.
+ *        Output the socket doesn't take is left pending, the callback doesn't wait on it.
+ */
+void IOService::flushWriteJobs()
+{
+    // Swap out, callbacks can add new writes for the next pass.
+    std::vector<service_base_ptr> write_jobs;
+    write_jobs.swap(m_write_jobs);
+
+    std::set<socket_handler_ptr> flushed;
+
+    for(auto &job_work : write_jobs)
+    {
+        socket_handler_ptr handle = job_work->getSocketHandle();
+
+        // First job on each connection flushes all fragments queued for it.
+        if(flushed.insert(handle).second)
+        {
+            flushConnection(handle);
+        }
+
+        if(!handle->isActive())
+        {
+            std::error_code lost_connect_error_code(1, std::system_category());
+            job_work->executeCallback(lost_connect_error_code, nullptr);
+        }
+        else
         {
-            log->xrmLog<Logging::DEBUG_LOG>("async accept - connection created.");
             std::error_code success_code(0, std::generic_category());
+            job_work->executeCallback(success_code, nullptr);
+        }
+    }
+}
 
-            try
-            {
-                // Check for max nodes here, if we like can limit, send a message and drop
-                // connection on hander by not passing it through the callback.
-                listener_work->executeCallback(success_code, handler);
-            }
-            catch(std::exception &ex)
-            {
-                log->xrmLog<Logging::ERROR_LOG>("Exception Async-Accept", ex.what(), __FILE__, __LINE__);
-            }
+/**
+ * @brief Sends what the connection's socket will take, the rest stays pending.
+ *        Connections over the drop limit are set inactive.
+ * @param handle
+ * @return false if the connection was lost.
+ */
+bool IOService::flushConnection(socket_handler_ptr handle)
+{
+    Logging *log = Logging::instance();
+    int socket_id = handle->getSocketId();
+    bool was_pending = (socket_id >= 0 && m_pending_output.count(socket_id) > 0);
+
+    if(handle->isActive() && handle->hasQueuedOutput())
+    {
+        if(handle->flushOutput() < 0)
+        {
+            // Error - Lost Connection
+            log->xrmLog<Logging::ERROR_LOG>("async_write - lost connection!");
+            handle->setInactive();
+        }
+        else if(m_output_drop_limit > 0 && handle->getQueuedOutputSize() > m_output_drop_limit)
+        {
+            log->xrmLog<Logging::ERROR_LOG>("async_write - client not reading, dropping connection, queued=",
+                                            handle->getQueuedOutputSize());
+            handle->setInactive();
         }
     }
+
+    // Sockets without a descriptor (SSH) block on send, so they don't leave anything pending.
+    if(socket_id < 0)
+    {
+        return handle->isActive();
+    }
+
+    if(!handle->isActive())
+    {
+        m_pending_output.erase(socket_id);
+#ifdef __linux__
+        releaseDescriptor(socket_id);
+#endif
+        return false;
+    }
+
+    bool is_pending = handle->hasQueuedOutput();
+
+    if(is_pending)
+    {
+        m_pending_output[socket_id] = handle;
+    }
+    else
+    {
+        m_pending_output.erase(socket_id);
+    }
+
+#ifdef __linux__
+
+    // Start or stop waiting for the socket to be writable.
+    if(is_pending != was_pending)
+    {
+        armDescriptor(socket_id);
+    }
+
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Retries connections with pending output (Polling loop).
+ */
+void IOService::flushPendingOutput()
+{
+    std::vector<socket_handler_ptr> pending;
+
+    for(auto &it : m_pending_output)
+    {
+        pending.push_back(it.second);
+    }
+
+    for(auto &handle : pending)
+    {
+        flushConnection(handle);
+    }
+}
+
+/**
+ * @brief Client isn't keeping up, hold reads until it's output drains.
+ * @param handle
+ * @return
+ */
+bool IOService::isOverHighWaterMark(socket_handler_ptr handle) const
+{
+    return m_output_high_water_mark > 0 && handle->getQueuedOutputSize() > m_output_high_water_mark;
+}
+
+/**
+ * @brief Per connection output limits, set before run().
+ * @param high_water_mark
+ * @param drop_limit
+ */
+void IOService::setOutputLimits(unsigned long high_water_mark, unsigned long drop_limit)
+{
+    m_output_high_water_mark = high_water_mark;
+    m_output_drop_limit = drop_limit;
+}
+
+/**
+ * @brief MCCP2 deflate settings for connections on this loop, set before run().
+ * @param level
+ * @param memory_limit_kb
+ */
+void IOService::setCompression(int level, int memory_limit_kb)
+{
+    m_compression_level = level;
+    m_compression_memory_kb = memory_limit_kb;
 }
 
+/**
+ * @brief Executes a job's callback on the thread running this service.
+ * @param job_work
+ */
+void IOService::executeDispatchJob(service_base_ptr job_work)
+{
+    Logging *log = Logging::instance();
+    std::error_code success_code(0, std::generic_category());
+
+    try
+    {
+        job_work->executeCallback(success_code, job_work->getSocketHandle());
+    }
+    catch(std::exception &ex)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("Exception Async-Dispatch", ex.what(), __FILE__, __LINE__);
+    }
+}
 
 /**
  * @brief Main looping method
  */
 void IOService::run()
 {
+    m_is_active = true;
+
+#ifdef __linux__
+
+    if(m_epoll_fd != -1 && m_wakeup_fd != -1)
+    {
+        runReactor();
+        return;
+    }
+
     Logging *log = Logging::instance();
+    log->xrmLog<Logging::ERROR_LOG>("Unable to setup epoll, falling back to socket polling.", __FILE__, __LINE__);
+#endif
 
-    char msg_buffer[MAX_BUFFER_SIZE];
-    m_is_active = true;
+    runPolling();
+}
+
+/**
+ * @brief Legacy main loop, scans each job and sleeps between passes.
+ */
+void IOService::runPolling()
+{
+    Logging *log = Logging::instance();
 
     while(m_is_active)
     {
+        // Pick up jobs submitted since the last pass.
+        service_base_ptr submitted;
+
+        while(m_submit_queue.pop(submitted))
+        {
+            addSubmittedJob(submitted);
+        }
+
         // Check for incomming connections
         checkAsyncListenersForConnections();
+        checkPriorityTimers();
 
-        // This will wait for another job to be inserted on next call
-        // Do we want to insert the job back, if poll is empty or
-        // move to vector then look polls..  i think #2.
-        for(unsigned int i = 0; i < m_service_list.size(); i++)
+        // Jobs stay linked until completed, callbacks submit new jobs to the
+        // Queue so the list isn't changed while walking it.
+        ServiceBase *next_job = nullptr;
+
+        for(ServiceBase *job = m_service_list.front(); job != nullptr; job = next_job)
         {
-            service_base_ptr job_work = m_service_list.get(i);
+            next_job = m_service_list.next(job);
 
-            if(!job_work || !job_work->getSocketHandle()->isActive())
+            if(!job->getSocketHandle()->isActive())
             {
-                m_service_list.remove(i);
-                --i; // Compensate for item removed.
+                m_service_list.remove(job);
                 continue;
             }
 
             /**
              * Handle Read Service if Data is Available.
              */
-            if(job_work->getServiceType() == SERVICE_TYPE_READ)
+            if(job->getServiceType() == SERVICE_TYPE_READ)
             {
+                // Hold reads while the client isn't taking it's output.
+                if(isOverHighWaterMark(job->getSocketHandle()))
+                {
+                    continue;
+                }
+
                 // If Data Available, read, then populate buffer
                 // Otherwise keep polling till data is available.
-                int result = job_work->getSocketHandle()->poll();
+                int result = job->getSocketHandle()->poll();
 
                 if(result > 0)
                 {
-                    memset(&msg_buffer, 0, MAX_BUFFER_SIZE);
-                    int length = job_work->getSocketHandle()->recvSocket(msg_buffer);
-
-                    if(length < 0)
-                    {
-                        // Error - Lost Connection
-                        log->xrmLog<Logging::ERROR_LOG>("async_read - lost connection!: ", length);
-                        job_work->getSocketHandle()->setInactive();
-                        std::error_code lost_connect_error_code(1, std::system_category());
-                        job_work->executeCallback(lost_connect_error_code, nullptr);
-                        m_service_list.remove(i);
-                        --i; // Compensate for item removed.
-                    }
-                    else
-                    {
-                        job_work->setBuffer((unsigned char *)msg_buffer);
-                        std::error_code success_code(0, std::generic_category());
-                        job_work->executeCallback(success_code, nullptr);
-                        m_service_list.remove(i);
-                        --i; // Compensate for item removed.
-                    }
+                    executeReadJob(m_service_list.remove(job));
                 }
                 else if(result == -1)
                 {
                     log->xrmLog<Logging::ERROR_LOG>("async_poll - lost connection!");
                     std::error_code lost_connect_error_code(1, std::system_category());
-                    job_work->executeCallback(lost_connect_error_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
+                    m_service_list.remove(job)->executeCallback(lost_connect_error_code, nullptr);
                 }
             }
 
             /**
              * Handle Write Service if Data is Available.
              */
-            else if(job_work->getServiceType() == SERVICE_TYPE_WRITE)
+            else if(job->getServiceType() == SERVICE_TYPE_WRITE)
             {
-                int result = job_work->getSocketHandle()->sendSocket(
-                                 (unsigned char*)job_work->getStringSequence().c_str(),
-                                 job_work->getStringSequence().size());
+                queueWriteJob(m_service_list.remove(job));
+            }
 
-                if(result <= 0)
-                {
-                    // Error - Lost Connection
-                    log->xrmLog<Logging::ERROR_LOG>("async_write - lost connection!");
-                    job_work->getSocketHandle()->setInactive();
-                    std::error_code lost_connect_error_code(1, std::system_category());
-                    job_work->executeCallback(lost_connect_error_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
-                }
-                else
-                {
-                    std::error_code success_code(0, std::generic_category());
-                    job_work->executeCallback(success_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
-                }
+            /**
+             * Handle Compress Service, start MCCP2 in order with the writes.
+             */
+            else if(job->getServiceType() == SERVICE_TYPE_COMPRESS)
+            {
+                queueCompressJob(m_service_list.remove(job));
+            }
+
+            /**
+             * Handle Dispatch Service, run the callback on this thread.
+             */
+            else if(job->getServiceType() == SERVICE_TYPE_DISPATCH)
+            {
+                executeDispatchJob(m_service_list.remove(job));
             }
 
             /*
@@ -301,10 +693,392 @@ void IOService::run()
 
         }
 
+        // Send all writes queued on this pass, one send per connection.
+        flushPendingOutput();
+        flushWriteJobs();
+
         // Temp timer, change to 10/20 miliseconds for cpu useage
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
     }
 
+    clearJobs();
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Arms (or Re-arms) a descriptor for a single read event.
+ * @param socket_id
+ * @param events
+ * @return
+ */
+bool IOService::registerDescriptor(int socket_id, unsigned int events)
+{
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = events;
+    event.data.fd = socket_id;
+
+    // Descriptors stay registered between reads, closed sockets are dropped
+    // By the kernel so a reused descriptor number needs to be added again.
+    if(epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, socket_id, &event) == 0)
+    {
+        return true;
+    }
+
+    return epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, socket_id, &event) == 0;
+}
+
+/**
+ * @brief Re-arms a connection for what it's waiting on, reads unless
+ *        held by backpressure, and writable when output is pending.
+ * @param socket_id
+ * @return
+ */
+bool IOService::armDescriptor(int socket_id)
+{
+    if(m_epoll_fd == -1 || m_wakeup_fd == -1)
+    {
+        return false;
+    }
+
+    unsigned int events = 0;
+    auto reader = m_read_jobs.find(socket_id);
+
+    if(reader != m_read_jobs.end() && !isOverHighWaterMark(reader->second->getSocketHandle()))
+    {
+        events |= EPOLLIN | EPOLLRDHUP;
+    }
+
+    if(m_pending_output.count(socket_id) > 0)
+    {
+        events |= EPOLLOUT;
+    }
+
+    // Nothing to wait on, a one shot descriptor stays disabled until re-armed.
+    if(events == 0)
+    {
+        return true;
+    }
+
+    return registerDescriptor(socket_id, events | EPOLLONESHOT);
+}
+
+/**
+ * @brief Removes a lost connection from the reactor, a waiting read is failed.
+ * @param socket_id
+ */
+void IOService::releaseDescriptor(int socket_id)
+{
+    if(m_epoll_fd != -1)
+    {
+        epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, socket_id, nullptr);
+    }
+
+    m_pending_output.erase(socket_id);
+    auto reader = m_read_jobs.find(socket_id);
+
+    if(reader != m_read_jobs.end())
+    {
+        service_base_ptr job_work = reader->second;
+        m_read_jobs.erase(reader);
+
+        std::error_code lost_connect_error_code(1, std::system_category());
+        job_work->executeCallback(lost_connect_error_code, nullptr);
+    }
+}
+
+/**
+ * @brief Moves newly added jobs into the reactor, writes are queued and flushed together.
+ */
+void IOService::collectReactorJobs()
+{
+    Logging *log = Logging::instance();
+    service_base_ptr job_work;
+
+    while(m_submit_queue.pop(job_work))
+    {
+        if(!job_work)
+        {
+            continue;
+        }
+
+        // Timers are scheduled on the wheel with asyncTimer().
+        if(SERVICE_TIMER(job_work->getServiceType()))
+        {
+            continue;
+        }
+
+        if(!job_work->getSocketHandle()->isActive())
+        {
+            continue;
+        }
+
+        if(SERVICE_LISTENER(job_work->getServiceType()))
+        {
+            int socket_id = job_work->getSocketHandle()->getSocketId();
+
+            if(socket_id < 0 || !registerDescriptor(socket_id, EPOLLIN))
+            {
+                log->xrmLog<Logging::ERROR_LOG>("Unable to register listener with epoll", __FILE__, __LINE__);
+                continue;
+            }
+
+            m_listener_jobs[socket_id] = job_work;
+        }
+        else if(job_work->getServiceType() == SERVICE_TYPE_WRITE)
+        {
+            queueWriteJob(job_work);
+        }
+        else if(job_work->getServiceType() == SERVICE_TYPE_COMPRESS)
+        {
+            queueCompressJob(job_work);
+        }
+        else if(job_work->getServiceType() == SERVICE_TYPE_DISPATCH)
+        {
+            executeDispatchJob(job_work);
+        }
+        else if(job_work->getServiceType() == SERVICE_TYPE_READ)
+        {
+            int socket_id = job_work->getSocketHandle()->getSocketId();
+
+            // Sockets without a descriptor to wait on are still polled.
+            if(socket_id < 0)
+            {
+                m_polled_jobs.push_back(job_work);
+                continue;
+            }
+
+            m_read_jobs[socket_id] = job_work;
+
+            if(!armDescriptor(socket_id))
+            {
+                log->xrmLog<Logging::ERROR_LOG>("async_read - unable to register socket with epoll", socket_id);
+                job_work->getSocketHandle()->setInactive();
+                m_read_jobs.erase(socket_id);
+                m_pending_output.erase(socket_id);
+                std::error_code lost_connect_error_code(1, std::system_category());
+                job_work->executeCallback(lost_connect_error_code, nullptr);
+            }
+        }
+    }
+
+    // Send all writes collected on this pass, one send per connection.
+    flushWriteJobs();
+}
+
+/**
+ * @brief Removes jobs on sockets that were closed while waiting.
+ */
+void IOService::removeInactiveJobs()
+{
+    for(auto it = m_read_jobs.begin(); it != m_read_jobs.end();)
+    {
+        if(!it->second->getSocketHandle()->isActive())
+        {
+            it = m_read_jobs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for(auto it = m_listener_jobs.begin(); it != m_listener_jobs.end();)
+    {
+        if(!it->second->getSocketHandle()->isActive())
+        {
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, it->first, nullptr);
+            it = m_listener_jobs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for(auto it = m_pending_output.begin(); it != m_pending_output.end();)
+    {
+        if(!it->second->isActive())
+        {
+            it = m_pending_output.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/**
+ * @brief Epoll main loop, blocks until a socket or listener is ready.
+ */
+void IOService::runReactor()
+{
+    Logging *log = Logging::instance();
+
+    const int max_events = 64;
+    struct epoll_event events[max_events];
+
+    std::chrono::steady_clock::time_point last_housekeeping = std::chrono::steady_clock::now();
+
+    while(m_is_active)
+    {
+        // Clear before collecting, anything added after this wakes the next wait.
+        m_is_wakeup_pending = false;
+        collectReactorJobs();
+        checkPriorityTimers();
+
+        int timeout = m_polled_jobs.is_empty() ? HOUSEKEEPING_MILLISECONDS : POLL_FALLBACK_MILLISECONDS;
+        int timer_timeout = m_timer_wheel.millisecondsUntilNext(std::chrono::steady_clock::now());
+
+        // Wake up for the next timer.
+        if(timer_timeout >= 0 && timer_timeout < timeout)
+        {
+            timeout = timer_timeout;
+        }
+        int num_events = epoll_wait(m_epoll_fd, events, max_events, timeout);
+
+        if(num_events == -1 && errno != EINTR)
+        {
+            log->xrmLog<Logging::ERROR_LOG>("epoll_wait failed=", strerror(errno), __FILE__, __LINE__);
+            break;
+        }
+
+        for(int i = 0; i < num_events; i++)
+        {
+            int socket_id = events[i].data.fd;
+
+            if(socket_id == m_wakeup_fd)
+            {
+                uint64_t counter = 0;
+
+                if(read(m_wakeup_fd, &counter, sizeof(counter)) == -1 && errno != EAGAIN)
+                {
+                    log->xrmLog<Logging::ERROR_LOG>("eventfd read failed=", strerror(errno), __FILE__, __LINE__);
+                }
+
+                continue;
+            }
+
+            auto listener = m_listener_jobs.find(socket_id);
+
+            if(listener != m_listener_jobs.end())
+            {
+                service_base_ptr listener_work = listener->second;
+
+                if(listener_work->getSocketHandle()->isActive())
+                {
+                    executeAcceptJob(listener_work);
+                }
+
+                continue;
+            }
+
+            // Socket is writable again, send what's left of it's output.
+            auto pending = m_pending_output.find(socket_id);
+
+            if(pending != m_pending_output.end() && (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+            {
+                socket_handler_ptr handle = pending->second;
+
+                if(!flushConnection(handle))
+                {
+                    continue;
+                }
+            }
+
+            auto reader = m_read_jobs.find(socket_id);
+
+            if(reader == m_read_jobs.end()
+                    || !(events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP)))
+            {
+                // One shot, wait again for whatever is still outstanding.
+                armDescriptor(socket_id);
+                continue;
+            }
+
+            // Remove first, the callback will queue the next read on this socket.
+            service_base_ptr job_work = reader->second;
+            m_read_jobs.erase(reader);
+
+            if(job_work->getSocketHandle()->isActive())
+            {
+                executeReadJob(job_work);
+            }
+
+            // Output still pending (and no new read yet), keep waiting to write.
+            if(m_pending_output.count(socket_id) > 0 && m_read_jobs.count(socket_id) == 0)
+            {
+                armDescriptor(socket_id);
+            }
+        }
+
+        // Sockets without a descriptor are polled on each pass.
+        ServiceBase *next_job = nullptr;
+
+        for(ServiceBase *job = m_polled_jobs.front(); job != nullptr; job = next_job)
+        {
+            next_job = m_polled_jobs.next(job);
+
+            if(!job->getSocketHandle()->isActive())
+            {
+                m_polled_jobs.remove(job);
+                continue;
+            }
+
+            if(isOverHighWaterMark(job->getSocketHandle()))
+            {
+                continue;
+            }
+
+            int result = job->getSocketHandle()->poll();
+
+            if(result > 0)
+            {
+                executeReadJob(m_polled_jobs.remove(job));
+            }
+            else if(result == -1)
+            {
+                log->xrmLog<Logging::ERROR_LOG>("async_poll - lost connection!");
+                std::error_code lost_connect_error_code(1, std::system_category());
+                m_polled_jobs.remove(job)->executeCallback(lost_connect_error_code, nullptr);
+            }
+        }
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if(now - last_housekeeping >= std::chrono::milliseconds(HOUSEKEEPING_MILLISECONDS))
+        {
+            removeInactiveJobs();
+            last_housekeeping = now;
+        }
+    }
+
+    clearJobs();
+}
+
+#endif
+
+/**
+ * @brief Interrupts a blocking reactor wait so newly added jobs are picked up.
+ */
+void IOService::wakeup()
+{
+#ifdef __linux__
+
+    // Only the first job added since the last pass needs to signal the loop.
+    if(m_wakeup_fd != -1 && !m_is_wakeup_pending.exchange(true))
+    {
+        uint64_t counter = 1;
+
+        if(write(m_wakeup_fd, &counter, sizeof(counter)) == -1)
+        {
+            m_is_wakeup_pending = false;
+        }
+    }
+
+#endif
 }
 
 /**
@@ -312,9 +1086,7 @@ void IOService::run()
  */
 void IOService::stop()
 {
+    // Lists are owned by the loop, it clears them and attached handles on exit.
     m_is_active = false;
-    // Clear All Lists and attached handles.
-    m_service_list.clear();
-    m_timer_list.clear();
-    m_listener_list.clear();
+    wakeup();
 }
@@ -1,13 +1,18 @@
 #ifndef IO_SERVICE_HPP
 #define IO_SERVICE_HPP
 
-#include "safe_vector.hpp"
+#include "mpsc_queue.hpp"
+#include "intrusive_list.hpp"
+#include "timer_wheel.hpp"
+#include "output_buffer.hpp"
 
 #include <functional>
 #include <sstream>
 #include <vector>
 #include <memory>
 #include <typeinfo>
+#include <atomic>
+#include <map>
 
 class SocketHandler;
 typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
@@ -26,6 +31,8 @@ const int SERVICE_TYPE_LISTENER_SSH      = 7;
 const int SERVICE_TYPE_LISTENER_IRC      = 8;
 const int SERVICE_TYPE_ASYNC_TIMER       = 9;
 const int SERVICE_TYPE_BLOCK_TIMER       = 10;
+const int SERVICE_TYPE_DISPATCH          = 11;
+const int SERVICE_TYPE_COMPRESS          = 12;
 
 #define SERVICE_TIMER(x) ((int)(x) <= SERVICE_TYPE_BLOCK_TIMER \
                           && (int)(x) >= SERVICE_TYPE_ASYNC_TIMER)
@@ -54,19 +61,25 @@ public:
 
     static const int MAX_BUFFER_SIZE = 16384;
 
+    // Connections taken off a listener's backlog each time it's ready,
+    // Leftovers are picked up on the next pass.
+    static const int MAX_ACCEPTS_PER_PASS = 64;
+
     /**
      * @class ServiceBase
      * @author Michael Griffin
      * @date 06/12/2017
      * @file io_service.hpp
      * @brief IO Service Job Base Template, needed to access virtual methods on ServiceJob
+     *        Carries it's own links for the loop's in-flight lists.
      */
-    class ServiceBase
+    class ServiceBase : public IntrusiveListHook<ServiceBase>
     {
     public:
-        virtual void setBuffer(unsigned char *buffer) = 0;
-        virtual std::vector<unsigned char> &getBuffer() = 0;
+        virtual ~ServiceBase() { }
+
         virtual std::string getStringSequence() = 0;
+        virtual output_buffer_ptr getOutputBuffer() = 0;
         virtual socket_handler_ptr getSocketHandle() = 0;
         virtual void executeCallback(const std::error_code &er, socket_handler_ptr conn) = 0;
         virtual int getServiceType() = 0;
@@ -80,26 +93,18 @@ public:
      * @file io_service.hpp
      * @brief IO Service Job Template
      */
-    template <class MutableBufferSequence, class StringSequence, class SocketHandle, class Callback, class ServiceType>
+    template <class StringSequence, class SocketHandle, class Callback, class ServiceType>
     class ServiceJob : public ServiceBase
     {
     public:
-        virtual void setBuffer(unsigned char *buffer)
-        {
-            for(int i = 0; i < MAX_BUFFER_SIZE; i++)
-            {
-                m_buffer.push_back(buffer[i]);
-            }
-        }
-
-        virtual std::vector<unsigned char> &getBuffer()
+        virtual std::string getStringSequence()
         {
-            return m_buffer;
+            return makeStringSequence(m_string_sequence);
         }
 
-        virtual std::string getStringSequence()
+        virtual output_buffer_ptr getOutputBuffer()
         {
-            return m_string_sequence;
+            return makeOutputBuffer(m_string_sequence);
         }
 
         virtual socket_handler_ptr getSocketHandle()
@@ -118,16 +123,14 @@ public:
             return m_service_type;
         }
 
-        ServiceJob(MutableBufferSequence &buffer, StringSequence string_sequence, SocketHandle socket_handle, Callback callback,
+        ServiceJob(StringSequence string_sequence, SocketHandle socket_handle, Callback callback,
                    ServiceType service_type)
-            : m_buffer(buffer)
-            , m_string_sequence(string_sequence)
+            : m_string_sequence(string_sequence)
             , m_socket_handle(socket_handle)
             , m_callback(callback)
             , m_service_type(service_type)
         { }
 
-        MutableBufferSequence &m_buffer;
         StringSequence         m_string_sequence;
         SocketHandle           m_socket_handle;
         Callback               m_callback;
@@ -135,54 +138,42 @@ public:
     };
 
     /**
-     * @brief Add Async Jobs to the Vector Queue
-     * @param buffer
+     * @brief Add Async Jobs to the Submission Queue, safe from any thread.
+     *        The loop sorts them into Timers, Listeners and Standard Jobs.
      * @param string_sequence
      * @param socket_handle
      * @param callback
      * @param service_type
      */
-    template <typename MutableBufferSequence, typename StringSequence, typename SocketHandle, typename Callback, typename ServiceType>
-    void addAsyncJob(MutableBufferSequence &buffer, StringSequence string_sequence, SocketHandle socket_handle,
+    template <typename StringSequence, typename SocketHandle, typename Callback, typename ServiceType>
+    void addAsyncJob(StringSequence string_sequence, SocketHandle socket_handle,
                      Callback &callback, ServiceType service_type)
     {
-        ServiceJob<MutableBufferSequence, StringSequence, SocketHandle, Callback, ServiceType> *job
-            = new ServiceJob <MutableBufferSequence, StringSequence, SocketHandle, Callback, ServiceType>
-        (buffer, string_sequence, socket_handle, callback, service_type);
+        ServiceJob<StringSequence, SocketHandle, Callback, ServiceType> *job
+            = new ServiceJob <StringSequence, SocketHandle, Callback, ServiceType>
+        (string_sequence, socket_handle, callback, service_type);
 
-        if (SERVICE_TIMER(service_type))
-        {
-            // Timer (Priority List Job)
-            m_timer_list.push_back(std::shared_ptr<ServiceBase>(job));
-        }
-        else if (SERVICE_LISTENER(service_type))
-        {
-            // Server Connection Listener Job (1) for each Service.
-            m_listener_list.push_back(std::shared_ptr<ServiceBase>(job));
-        }
-        else
-        {
-            // Standard Async Job
-            m_service_list.push_back(std::shared_ptr<ServiceBase>(job));
-        }
+        m_submit_queue.push(std::shared_ptr<ServiceBase>(job));
+
+        // Let the reactor know there is new work to pick up.
+        wakeup();
     }
 
     /**
      * NOT IN USE RIGHT NOW
      * @brief Delete an active Async Job in the Vector Queue
-     * @param buffer
      * @param string_sequence
      * @param socket_handle
      * @param callback
      * @param service_type
      *
-    template <typename MutableBufferSequence, typename StringSequence, typename SocketHandle, typename Callback, typename ServiceType>
-    void delAsyncJob(MutableBufferSequence &buffer, StringSequence string_sequence, SocketHandle socket_handle,
+    template <typename StringSequence, typename SocketHandle, typename Callback, typename ServiceType>
+    void delAsyncJob(StringSequence string_sequence, SocketHandle socket_handle,
                      Callback &callback, ServiceType service_type)
     {
-        ServiceJob<MutableBufferSequence, StringSequence, SocketHandle, Callback, ServiceType> *job
-            = new ServiceJob <MutableBufferSequence, StringSequence, SocketHandle, Callback, ServiceType>
-        (buffer, string_sequence, socket_handle, callback, service_type);
+        ServiceJob<StringSequence, SocketHandle, Callback, ServiceType> *job
+            = new ServiceJob <StringSequence, SocketHandle, Callback, ServiceType>
+        (string_sequence, socket_handle, callback, service_type);
 
         if (SERVICE_TIMER(service_type))
         {
@@ -201,6 +192,14 @@ public:
         }
     }*/
 
+    /**
+     * @brief Schedules a callback on this loop's timer wheel, safe from any thread.
+     * @param milliseconds
+     * @param callback
+     * @return Handle to cancel the timer.
+     */
+    timer_entry_ptr asyncTimer(int milliseconds, TimerEntry::callback_function_handler callback);
+
     /**
      * @Brief Always check all timers (Priority each iteration)
      */
@@ -221,10 +220,172 @@ public:
      */
     void stop();
 
-    SafeVector<service_base_ptr>  m_service_list;
-    SafeVector<service_base_ptr>  m_timer_list;
-    SafeVector<service_base_ptr>  m_listener_list;
-    bool                          m_is_active;
+    /**
+     * @brief Interrupts a blocking reactor wait so newly added jobs are picked up.
+     */
+    void wakeup();
+
+    /**
+     * @brief Per connection output limits, set before run().
+     * @param high_water_mark - reads are held while more then this is queued (0 = off)
+     * @param drop_limit - connection is dropped when more then this is queued (0 = off)
+     */
+    void setOutputLimits(unsigned long high_water_mark, unsigned long drop_limit);
+
+    /**
+     * @brief MCCP2 deflate settings for connections on this loop, set before run().
+     * @param level - zlib level 1 - 9
+     * @param memory_limit_kb - deflate state per connection
+     */
+    void setCompression(int level, int memory_limit_kb);
+
+    std::atomic_bool              m_is_active;
+
+private:
+
+    // Jobs from any thread, only this loop takes them off.
+    MpscQueue<service_base_ptr>   m_submit_queue;
+
+    // In-Flight jobs owned by this loop, removed in O(1) when completed.
+    IntrusiveList<ServiceBase>    m_service_list;
+    IntrusiveList<ServiceBase>    m_listener_list;
+
+    // Timers from any thread, scheduled on this loop's wheel.
+    MpscQueue<timer_entry_ptr>    m_timer_queue;
+    TimerWheel                    m_timer_wheel;
+
+    // Writes queued on the current pass, waiting to be flushed.
+    std::vector<service_base_ptr> m_write_jobs;
+
+    // Connections (by socket id) with output the socket couldn't take yet.
+    std::map<int, socket_handler_ptr> m_pending_output;
+    unsigned long                     m_output_high_water_mark;
+    unsigned long                     m_output_drop_limit;
+    int                               m_compression_level;
+    int                               m_compression_memory_kb;
+
+    /**
+     * @brief Sends what the connection's socket will take, the rest stays pending.
+     *        Connections over the drop limit are set inactive.
+     * @param handle
+     * @return false if the connection was lost.
+     */
+    bool flushConnection(socket_handler_ptr handle);
+
+    /**
+     * @brief Retries connections with pending output (Polling loop).
+     */
+    void flushPendingOutput();
+
+    /**
+     * @brief Client isn't keeping up, hold reads until it's output drains.
+     * @param handle
+     * @return
+     */
+    bool isOverHighWaterMark(socket_handler_ptr handle) const;
+
+    /**
+     * @brief Reads into the connection's own buffer, then executes the job callback.
+     * @param job_work
+     */
+    void executeReadJob(service_base_ptr job_work);
+
+    /**
+     * @brief Queues a job's string sequence on it's connection, sent on the next flush.
+     * @param job_work
+     */
+    void queueWriteJob(service_base_ptr job_work);
+
+    /**
+     * @brief Queues the MCCP2 start sequence as is, then everything after it is compressed.
+     * @param job_work
+     */
+    void queueCompressJob(service_base_ptr job_work);
+
+    /**
+     * @brief Sends all queued output (once per connection), then executes the job callbacks.
+     */
+    void flushWriteJobs();
+
+    /**
+     * @brief Executes the listener callback for each accepted connection.
+     * @param listener_work
+     */
+    void executeAcceptJob(service_base_ptr listener_work);
+
+    /**
+     * @brief Executes a job's callback on the thread running this service.
+     * @param job_work
+     */
+    void executeDispatchJob(service_base_ptr job_work);
+
+    /**
+     * @brief Sorts a submitted job into the Listener or Standard list.
+     * @param job_work
+     */
+    void addSubmittedJob(service_base_ptr job_work);
+
+    /**
+     * @brief Releases all jobs, on the loop's thread after it exits.
+     */
+    void clearJobs();
+
+    /**
+     * @brief Legacy main loop, scans each job and sleeps between passes.
+     */
+    void runPolling();
+
+#ifdef __linux__
+
+    // Wait on sockets without a descriptor (SSH) and house keeping.
+    static const int POLL_FALLBACK_MILLISECONDS = 20;
+    static const int HOUSEKEEPING_MILLISECONDS  = 1000;
+
+    /**
+     * @brief Epoll main loop, blocks until a socket or listener is ready.
+     */
+    void runReactor();
+
+    /**
+     * @brief Moves newly added jobs into the reactor, writes are queued and flushed together.
+     */
+    void collectReactorJobs();
+
+    /**
+     * @brief Arms (or Re-arms) a descriptor for a single read event.
+     * @param socket_id
+     * @param events
+     * @return
+     */
+    bool registerDescriptor(int socket_id, unsigned int events);
+
+    /**
+     * @brief Re-arms a connection for what it's waiting on, reads unless
+     *        held by backpressure, and writable when output is pending.
+     * @param socket_id
+     * @return
+     */
+    bool armDescriptor(int socket_id);
+
+    /**
+     * @brief Removes a lost connection from the reactor, a waiting read is failed.
+     * @param socket_id
+     */
+    void releaseDescriptor(int socket_id);
+
+    /**
+     * @brief Removes jobs on sockets that were closed while waiting.
+     */
+    void removeInactiveJobs();
+
+    int                               m_epoll_fd;
+    int                               m_wakeup_fd;
+    std::atomic_bool                  m_is_wakeup_pending;
+    std::map<int, service_base_ptr>   m_read_jobs;
+    std::map<int, service_base_ptr>   m_listener_jobs;
+    IntrusiveList<ServiceBase>        m_polled_jobs;
+
+#endif
 
 };
 
@@ -0,0 +1,162 @@
+#ifndef IO_SERVICE_POOL_HPP
+#define IO_SERVICE_POOL_HPP
+
+#include "io_service.hpp"
+#include "logging.hpp"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+/**
+ * @class IOServicePool
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file io_service_pool.hpp
+ * @brief Pool of IOService loops, each running on it's own thread.
+ *        Connections are assigned to a single loop for their lifetime
+ *        So session state is only ever touched by one thread.
+ */
+class IOServicePool
+{
+public:
+
+    typedef std::shared_ptr<IOService> io_service_ptr;
+
+    explicit IOServicePool(int pool_size)
+        : m_next_service(0)
+    {
+        // Default to one loop per core, 0 or less is the default.
+        if(pool_size <= 0)
+        {
+            pool_size = std::thread::hardware_concurrency();
+        }
+
+        if(pool_size <= 0)
+        {
+            pool_size = 1;
+        }
+
+        for(int i = 0; i < pool_size; i++)
+        {
+            m_io_services.push_back(io_service_ptr(new IOService()));
+        }
+    }
+
+    ~IOServicePool()
+    {
+        stop();
+        std::vector<io_service_ptr>().swap(m_io_services);
+    }
+
+    /**
+     * @brief Per connection output limits for each loop, set before run().
+     * @param high_water_mark
+     * @param drop_limit
+     */
+    void setOutputLimits(int high_water_mark, int drop_limit)
+    {
+        for(auto &io_service : m_io_services)
+        {
+            io_service->setOutputLimits(
+                (high_water_mark > 0) ? high_water_mark : 0,
+                (drop_limit > 0) ? drop_limit : 0);
+        }
+    }
+
+    /**
+     * @brief MCCP2 deflate settings for each loop, set before run().
+     * @param level
+     * @param memory_limit_kb
+     */
+    void setCompression(int level, int memory_limit_kb)
+    {
+        for(auto &io_service : m_io_services)
+        {
+            io_service->setCompression(level, memory_limit_kb);
+        }
+    }
+
+    /**
+     * @brief Start each IOService loop in it's own worker thread.
+     */
+    void run()
+    {
+        Logging *log = Logging::instance();
+        log->xrmLog<Logging::INFO_LOG>("Starting IOService loops", m_io_services.size());
+
+        for(auto &io_service : m_io_services)
+        {
+            m_threads.push_back(std::thread([io_service] { io_service->run(); }));
+        }
+    }
+
+    /**
+     * @brief Stop each loop, then wait for the worker threads to exit.
+     */
+    void stop()
+    {
+        for(auto &io_service : m_io_services)
+        {
+            io_service->stop();
+        }
+
+        for(auto &thread : m_threads)
+        {
+            if(thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        std::vector<std::thread>().swap(m_threads);
+    }
+
+    /**
+     * @brief Loop which handles listeners and accepting connections.
+     * @return
+     */
+    IOService &getListenerService()
+    {
+        return *m_io_services.front();
+    }
+
+    /**
+     * @brief Loop by index, for one listener per loop.
+     * @param index
+     * @return
+     */
+    IOService &getService(unsigned int index)
+    {
+        return *m_io_services.at(index);
+    }
+
+    /**
+     * @brief Next loop (Round Robin) for assigning a new connection.
+     * @return
+     */
+    IOService &getNextService()
+    {
+        unsigned int index = m_next_service++ % m_io_services.size();
+        return *m_io_services[index];
+    }
+
+    /**
+     * @brief Number of loops in the pool.
+     * @return
+     */
+    unsigned int size() const
+    {
+        return m_io_services.size();
+    }
+
+private:
+
+    std::vector<io_service_ptr> m_io_services;
+    std::vector<std::thread>    m_threads;
+    std::atomic<unsigned int>   m_next_service;
+
+};
+
+#endif // IO_SERVICE_POOL_HPP
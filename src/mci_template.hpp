@@ -0,0 +1,447 @@
+#ifndef MCI_TEMPLATE_HPP
+#define MCI_TEMPLATE_HPP
+
+#include "model-sys/structures.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class MciTemplate;
+typedef std::shared_ptr<const MciTemplate> mci_template_ptr;
+
+/**
+ * @class MciTemplate
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file mci_template.hpp
+ * @brief Screen or Prompt compiled once into MCI / Pipe Code slots, the text between
+ *        them are literal spans copied as is.  Codes are found with a hand written
+ *        scanner that matches the same codes, in the same groups, as SessionIO's expressions.
+ *        Templates are immutable and cached, so they are shared between sessions.
+ */
+class MciTemplate
+{
+public:
+
+    // Code Syntax a sequence is scanned with.
+    enum
+    {
+        MCI_STANDARD,   // |00 |XY0101 |A1 |AA %%FILENAME.EXT %AA %00
+        MCI_GENERIC,    // |A1 |AA
+        MCI_PROMPT,     // ^A and an input marker at the end
+        MCI_FORMAT,     // [text] and :
+        MCI_SYNTAX_COUNT
+    };
+
+    // Once over, the least recently used templates are dropped.
+    static const std::size_t MAX_CACHED_TEMPLATES = 1024;
+    static const std::size_t MAX_CACHED_BYTES     = 4 * 1024 * 1024;
+
+    MciTemplate(int syntax, const std::string &sequence)
+        : m_code_map()
+        , m_length(sequence.size())
+    {
+        compile(syntax, sequence);
+    }
+
+    /**
+     * @brief Code Slots in order of offset, with the matching expression group.
+     * @return
+     */
+    const std::vector<MapType> &getCodeMap() const
+    {
+        return m_code_map;
+    }
+
+    /**
+     * @brief Length of the sequence the template was compiled from.
+     * @return
+     */
+    std::string::size_type getLength() const
+    {
+        return m_length;
+    }
+
+    /**
+     * @brief Single pass, literal spans are copied and each code slot is filled in by the callback.
+     * @param sequence - The same sequence the template was compiled from.
+     * @param output - Appended to
+     * @param replace - void(const MapType &code, std::string &output) appends the replacement.
+     */
+    template <typename Replace>
+    void render(const std::string &sequence, std::string &output, Replace replace) const
+    {
+        std::string::size_type position = 0;
+        output.reserve(output.size() + sequence.size());
+
+        for(auto &code : m_code_map)
+        {
+            output.append(sequence, position, code.m_offset - position);
+            replace(code, output);
+            position = code.m_offset + code.m_length;
+        }
+
+        output.append(sequence, position, std::string::npos);
+    }
+
+    /**
+     * @brief Compiled template from the cache, or compile and cache it.  Thread Safe.
+     * @param syntax
+     * @param sequence
+     * @return
+     */
+    static mci_template_ptr getTemplate(int syntax, const std::string &sequence)
+    {
+        static TemplateCache cache;
+
+        if(syntax < 0 || syntax >= MCI_SYNTAX_COUNT)
+        {
+            syntax = MCI_STANDARD;
+        }
+
+        mci_template_ptr cached_template = cache.find(syntax, sequence);
+
+        if(cached_template)
+        {
+            return cached_template;
+        }
+
+        // Compiled outside the lock, if another thread beats us to it either is fine.
+        mci_template_ptr new_template = std::make_shared<const MciTemplate>(syntax, sequence);
+
+        if(sequence.size() < MAX_CACHED_BYTES / 16)
+        {
+            cache.insert(syntax, sequence, new_template);
+        }
+
+        return new_template;
+    }
+
+private:
+
+    /**
+     * @class TemplateCache
+     * @brief Compiled Templates by syntax and sequence, with the least recently
+     *        used dropped once over the limits, so strings with changing values
+     *        (names, times, counters) don't push out the menus and prompts in use.
+     *        Thread Safe.
+     */
+    class TemplateCache
+    {
+    public:
+
+        TemplateCache()
+            : m_mutex()
+            , m_lru()
+            , m_count(0)
+            , m_bytes(0)
+        {
+        }
+
+        /**
+         * @brief Cached template, moved to the front as most recently used.
+         * @param syntax
+         * @param sequence
+         * @return Null if it's not cached.
+         */
+        mci_template_ptr find(int syntax, const std::string &sequence)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_cache[syntax].find(sequence);
+
+            if(it == m_cache[syntax].end())
+            {
+                return nullptr;
+            }
+
+            m_lru.splice(m_lru.begin(), m_lru, it->second.m_lru_position);
+            return it->second.m_template;
+        }
+
+        /**
+         * @brief Add a template, then drop the least recently used down to the limits.
+         * @param syntax
+         * @param sequence
+         * @param new_template
+         */
+        void insert(int syntax, const std::string &sequence, mci_template_ptr new_template)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto result = m_cache[syntax].insert(std::make_pair(sequence, CachedTemplate()));
+
+            if(!result.second)
+            {
+                return;
+            }
+
+            // Map keys don't move, the list refers to the key instead of a second copy.
+            m_lru.push_front(std::make_pair(syntax, &result.first->first));
+            result.first->second.m_template = new_template;
+            result.first->second.m_lru_position = m_lru.begin();
+
+            ++m_count;
+            m_bytes += sequence.size();
+
+            while((m_count > MAX_CACHED_TEMPLATES || m_bytes > MAX_CACHED_BYTES) && m_lru.size() > 1)
+            {
+                int oldest_syntax = m_lru.back().first;
+                auto oldest = m_cache[oldest_syntax].find(*m_lru.back().second);
+
+                --m_count;
+                m_bytes -= oldest->first.size();
+                m_lru.pop_back();
+                m_cache[oldest_syntax].erase(oldest);
+            }
+        }
+
+    private:
+
+        typedef std::list<std::pair<int, const std::string *>> lru_list;
+
+        struct CachedTemplate
+        {
+            mci_template_ptr   m_template;
+            lru_list::iterator m_lru_position;
+        };
+
+        std::mutex                                      m_mutex;
+        std::unordered_map<std::string, CachedTemplate> m_cache[MCI_SYNTAX_COUNT];
+        lru_list                                        m_lru;
+        std::size_t                                     m_count;
+        std::size_t                                     m_bytes;
+    };
+
+    static bool isUpper(char c)
+    {
+        return c >= 'A' && c <= 'Z';
+    }
+
+    static bool isDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool isWord(char c)
+    {
+        return isUpper(c) || isDigit(c) || (c >= 'a' && c <= 'z') || c == '_';
+    }
+
+    /**
+     * @brief Count of matching characters from the position, up to a maximum.
+     */
+    template <typename Test>
+    static std::string::size_type countRun(const std::string &sequence, std::string::size_type position,
+                                           std::string::size_type maximum, Test test)
+    {
+        std::string::size_type count = 0;
+
+        while(count < maximum && position + count < sequence.size() && test(sequence[position + count]))
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Pipe and Percent Codes, Groups 1 - 7
+     * @return Length matched, 0 for none.
+     */
+    static std::string::size_type matchStandard(const std::string &sequence, std::string::size_type i, int &group)
+    {
+        if(sequence[i] == '|')
+        {
+            // |00
+            if(countRun(sequence, i + 1, 2, isDigit) == 2)
+            {
+                group = 1;
+                return 3;
+            }
+
+            // |XY0101
+            if(sequence.compare(i + 1, 2, "XY") == 0 && countRun(sequence, i + 3, 4, isDigit) == 4)
+            {
+                group = 2;
+                return 7;
+            }
+
+            // |A1 |A22 |AA2 |AA33
+            std::string::size_type letters = countRun(sequence, i + 1, 2, isUpper);
+            std::string::size_type digits = (letters > 0) ? countRun(sequence, i + 1 + letters, 2, isDigit) : 0;
+
+            if(digits > 0)
+            {
+                group = 3;
+                return 1 + letters + digits;
+            }
+
+            // |AA
+            if(letters == 2)
+            {
+                group = 4;
+                return 3;
+            }
+        }
+        else if(sequence[i] == '%')
+        {
+            // %%FILENAME.EXT
+            if(i + 1 < sequence.size() && sequence[i + 1] == '%')
+            {
+                std::string::size_type name = countRun(sequence, i + 2, std::string::npos, isWord);
+                std::string::size_type dot = i + 2 + name;
+
+                if(name > 0 && dot < sequence.size() && sequence[dot] == '.' &&
+                        countRun(sequence, dot + 1, 3, isWord) == 3)
+                {
+                    group = 5;
+                    return dot + 4 - i;
+                }
+            }
+
+            // %AA
+            if(countRun(sequence, i + 1, 2, isUpper) == 2)
+            {
+                group = 6;
+                return 3;
+            }
+
+            // %00
+            if(countRun(sequence, i + 1, 2, isDigit) == 2)
+            {
+                group = 7;
+                return 3;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Generic Pipe Codes, |A1 |A22 (Group 1) |AA (Group 2)
+     * @return Length matched, 0 for none.
+     */
+    static std::string::size_type matchGeneric(const std::string &sequence, std::string::size_type i, int &group)
+    {
+        if(sequence[i] != '|' || countRun(sequence, i + 1, 1, isUpper) == 0)
+        {
+            return 0;
+        }
+
+        std::string::size_type digits = countRun(sequence, i + 2, 2, isDigit);
+
+        if(digits > 0)
+        {
+            group = 1;
+            return 2 + digits;
+        }
+
+        if(countRun(sequence, i + 2, 1, isUpper) == 1)
+        {
+            group = 2;
+            return 3;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Prompt Codes, ^A (Group 1) and the Input Marker ending the prompt (Group 2)
+     * @return Length matched, 0 for none.
+     */
+    static std::string::size_type matchPrompt(const std::string &sequence, std::string::size_type i, int &group)
+    {
+        if(sequence[i] == '^' && countRun(sequence, i + 1, 1, isUpper) == 1)
+        {
+            group = 1;
+            return 2;
+        }
+
+        static const std::string input_markers = "\\/=|@*:#)(";
+
+        if(i + 1 == sequence.size() && input_markers.find(sequence[i]) != std::string::npos)
+        {
+            group = 2;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Format Codes, [text] (Group 1) and : (Group 2)
+     *        ECMAScript reads []] as an empty class, so brackets never match
+     *        the expression and only colons are found.
+     * @return Length matched, 0 for none.
+     */
+    static std::string::size_type matchFormat(const std::string &sequence, std::string::size_type i, int &group)
+    {
+        if(sequence[i] == ':')
+        {
+            group = 2;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Scan for the leftmost code at each position, then continue after it.
+     * @param syntax
+     * @param sequence
+     */
+    void compile(int syntax, const std::string &sequence)
+    {
+        std::string::size_type i = 0;
+
+        while(i < sequence.size())
+        {
+            int group = 0;
+            std::string::size_type length = 0;
+
+            switch(syntax)
+            {
+                case MCI_GENERIC:
+                    length = matchGeneric(sequence, i, group);
+                    break;
+
+                case MCI_PROMPT:
+                    length = matchPrompt(sequence, i, group);
+                    break;
+
+                case MCI_FORMAT:
+                    length = matchFormat(sequence, i, group);
+                    break;
+
+                default:
+                    length = matchStandard(sequence, i, group);
+                    break;
+            }
+
+            if(length == 0)
+            {
+                ++i;
+                continue;
+            }
+
+            MapType code;
+            code.m_offset = i;
+            code.m_length = length;
+            code.m_match  = group;
+            code.m_code   = sequence.substr(i, length);
+            code.m_or     = false;
+            m_code_map.push_back(std::move(code));
+
+            i += length;
+        }
+    }
+
+    std::vector<MapType>   m_code_map;
+    std::string::size_type m_length;
+};
+
+#endif // MCI_TEMPLATE_HPP
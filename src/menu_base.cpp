@@ -20,8 +20,8 @@
 MenuBase::MenuBase(session_data_ptr session_data)
     : m_menu_session_data(session_data)
     , m_session_io(session_data)
-    , m_config(new Config())
-    , m_directory(new Directory())
+    , m_config(TheCommunicator::instance()->getConfiguration())
+    , m_directory(makeArenaShared<Directory>(session_data->m_session_arena))
     , m_line_buffer("")
     , m_use_hotkey(false)
     , m_current_menu("")
@@ -29,9 +29,10 @@ MenuBase::MenuBase(session_data_ptr session_data)
     , m_fallback_menu("")
     , m_starting_menu("")
     , m_input_index(MENU_INPUT)
-    , m_menu_info(new Menu())
+    , m_menu_info(makeArenaShared<Menu>(session_data->m_session_arena))
     , m_menu_prompt()
-    , m_ansi_process(new AnsiProcessor(
+    , m_ansi_process(makeArenaShared<AnsiProcessor>(
+                         session_data->m_session_arena,
                          session_data->m_telnet_state->getTermRows(),
                          session_data->m_telnet_state->getTermCols()))
     , m_active_pulldownID(0)
@@ -41,7 +42,6 @@ MenuBase::MenuBase(session_data_ptr session_data)
     , m_use_first_command_execution(true)
     , m_logoff(false)
 {
-    m_config = TheCommunicator::instance()->getConfiguration();
 }
 
 MenuBase::~MenuBase()
@@ -160,7 +160,7 @@ void MenuBase::readInMenuData()
     // For PreLoading and Testing Menu ACS String
     {
         // Pre-Load Menu, check access, if not valud, then fall back to previous.
-        menu_ptr pre_load_menu(new Menu());
+        menu_ptr pre_load_menu = makeArenaShared<Menu>(m_menu_session_data->m_session_arena);
 
         // Call MenuDao to readin .yaml file
         MenuDao mnu(pre_load_menu, m_current_menu, GLOBAL_MENU_PATH);
@@ -271,10 +271,10 @@ std::string MenuBase::processTopGenericTemplate(const std::string &screen)
 std::string MenuBase::processMidGenericTemplate(const std::string &screen)
 {
     // Use a Local Ansi Parser for Pasrsing Menu Template with Mid.
-    ansi_process_ptr ansi_process(new AnsiProcessor(
-                                      m_menu_session_data->m_telnet_state->getTermRows(),
-                                      m_menu_session_data->m_telnet_state->getTermCols())
-                                 );
+    ansi_process_ptr ansi_process = makeArenaShared<AnsiProcessor>(
+                                        m_menu_session_data->m_session_arena,
+                                        m_menu_session_data->m_telnet_state->getTermRows(),
+                                        m_menu_session_data->m_telnet_state->getTermCols());
     std::string output_screen;
     std::string new_screen = screen;
 
@@ -877,7 +877,7 @@ std::string MenuBase::loadMenuPrompt()
     }
 
     // Load Menu prompt.
-    m_menu_prompt.reset(new MenuPrompt());
+    m_menu_prompt = makeArenaShared<MenuPrompt>(m_menu_session_data->m_session_arena);
 
     // Load YAML Menu Prompt
     MenuPromptDao mnu_prompt(m_menu_prompt, prompt, GLOBAL_MENU_PROMPT_PATH);
@@ -1145,7 +1145,15 @@ void MenuBase::lightbarUpdate(unsigned int previous_pulldown_id)
     // Clear Attriutes, then move back to menu prompt position.
     light_bars.append("\x1b[0m\x1b[u");
     std::string output = m_session_io.pipe2ansi(light_bars);
-    baseProcessAndDeliver(output);
+
+    // Plot the bars in the screen buffer, only the cells that changed are sent.
+    m_ansi_process->parseAnsiScreen((char *)output.c_str());
+    std::string difference = m_ansi_process->getScreenDifference();
+
+    if(difference.size() > 0)
+    {
+        m_menu_session_data->deliver("\x1b[s" + difference + "\x1b[u");
+    }
 }
 
 /**
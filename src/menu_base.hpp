@@ -115,6 +115,9 @@ public:
     {
         m_ansi_process->parseAnsiScreen((char *)data.c_str());
         m_menu_session_data->deliver(data);
+
+        // Client has everything, later updates are sent as differences.
+        m_ansi_process->markScreenFlushed();
     }
 
     /**
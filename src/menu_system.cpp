@@ -74,6 +74,22 @@ void MenuSystem::update(const std::string &character_buffer, const bool &is_utf8
     m_menu_functions[m_input_index](character_buffer, is_utf8);
 }
 
+/**
+ * @brief Batched Input, Modules can take a whole run at once, Menus by glyph.
+ * @param glyphs
+ */
+void MenuSystem::updateGlyphs(GlyphSpan &glyphs)
+{
+    if(!m_is_active || m_input_index != MODULE_INPUT || m_module_stack.size() == 0)
+    {
+        StateBase::updateGlyphs(glyphs);
+        return;
+    }
+
+    m_module_stack.back()->updateGlyphs(glyphs);
+    moduleCheckCompleted();
+}
+
 /**
  * @brief Startup class, setup initial screens / interface, flags etc..
  *        This is only called when switch to the state, not for menu instances.
@@ -954,7 +970,7 @@ void MenuSystem::startupModulePreLogon()
     resetMenuInputIndex(MODULE_PRELOGON_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModPreLogon(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModPreLogon>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -975,7 +991,7 @@ void MenuSystem::startupModuleLogon()
     resetMenuInputIndex(MODULE_LOGON_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModLogon(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModLogon>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -996,7 +1012,7 @@ void MenuSystem::startupModuleSignup()
     resetMenuInputIndex(MODULE_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModSignup(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModSignup>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -1017,7 +1033,7 @@ void MenuSystem::startupModuleMenuEditor()
     resetMenuInputIndex(MODULE_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModMenuEditor(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModMenuEditor>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -1038,7 +1054,7 @@ void MenuSystem::startupModuleUserEditor()
     resetMenuInputIndex(MODULE_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModUserEditor(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModUserEditor>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -1059,7 +1075,7 @@ void MenuSystem::startupModuleLevelEditor()
     resetMenuInputIndex(MODULE_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModLevelEditor(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModLevelEditor>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -1080,7 +1096,7 @@ void MenuSystem::startupModuleMessageEditor()
     resetMenuInputIndex(MODULE_INPUT);
 
     // Allocate and Create
-    module_ptr module(new ModMessageEditor(m_session_data, m_config, m_ansi_process));
+    module_ptr module = makeArenaShared<ModMessageEditor>(m_session_data->m_session_arena, m_session_data, m_config, m_ansi_process);
 
     if(!module)
     {
@@ -1183,7 +1199,14 @@ void MenuSystem::moduleInput(const std::string &character_buffer, const bool &is
 
     // Execute the modules update pass through input.
     m_module_stack.back()->update(character_buffer, is_utf8);
+    moduleCheckCompleted();
+}
 
+/**
+ * @brief Shutdown the Module once it's finished, then return to the Menu.
+ */
+void MenuSystem::moduleCheckCompleted()
+{
     // Finished modules processing.
     if(!m_module_stack.back()->m_is_active)
     {
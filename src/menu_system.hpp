@@ -38,6 +38,7 @@ public:
     ~MenuSystem();
 
     virtual void update(const std::string &character_buffer, const bool &is_utf8) override;
+    virtual void updateGlyphs(GlyphSpan &glyphs) override;
     virtual bool onEnter() override;
     virtual bool onExit() override;
 
@@ -274,6 +275,11 @@ public:
      */
     void moduleInput(const std::string &character_buffer, const bool &is_utf8);
 
+    /**
+     * @brief Shutdown the current module once it's finished.
+     */
+    void moduleCheckCompleted();
+
 };
 
 #endif // MENU_SYSTEM_HPP
@@ -211,6 +211,24 @@ public:
 
     std::string logging_level;
 
+// int
+    int io_service_threads;        // new { IO loops, 0 = hardware_concurrency }
+    int output_high_water_mark;    // new { Bytes queued per node before reads are held, 0 = off }
+    int output_drop_limit;         // new { Bytes queued per node before it's dropped, 0 = off }
+    int max_nodes;                 // new { Max connected nodes, 0 = no limit }
+    int max_connections_per_ip;    // new { Max nodes from one IP Address, 0 = no limit }
+    int max_accepts_per_second;    // new { New connections accepted per second, 0 = no limit }
+    int mccp_compression_level;    // new { MCCP2 zlib level 1-9, 0 = Off }
+    int mccp_memory_limit_kb;      // new { MCCP2 deflate memory per session (KB) }
+    int logon_timeout_minutes;     // new { Idle minutes allowed before logon, 0 disables }
+    int idle_warning_seconds;      // new { Warn users this long before an idle disconnect }
+    int keepalive_seconds;         // new { Telnet NOP probe after seconds without input, 0 disables }
+    int screen_cache_kb;           // new { Shared cache of parsed screens (KB), 0 disables }
+
+// bool
+    bool use_listener_reuse_port;  // new { Listener per IO loop with SO_REUSEPORT }
+    bool use_posix_sockets;        // new { Raw POSIX sockets, no select() FD_SETSIZE limit }
+
 
     explicit Config()
         : file_version(FILE_VERSION)
@@ -324,6 +342,20 @@ public:
         , regexp_email_validation("[\\w.]+[@]{1}[\\w]+[.]*[\\w]*")
         , regexp_email_validation_msg("Must be a valid email at the very lest name@domain")
         , logging_level("INFO")
+        , io_service_threads(0)
+        , output_high_water_mark(262144)
+        , output_drop_limit(1048576)
+        , max_nodes(0)
+        , max_connections_per_ip(0)
+        , max_accepts_per_second(0)
+        , mccp_compression_level(6)
+        , mccp_memory_limit_kb(128)
+        , logon_timeout_minutes(5)
+        , idle_warning_seconds(60)
+        , keepalive_seconds(120)
+        , screen_cache_kb(8192)
+        , use_listener_reuse_port(false)
+        , use_posix_sockets(true)
     {
         // Generates an Initial Unique Board UUID when the configuration is created.
         // If someone wipes out their config, they should save this and re-enter it!
@@ -464,6 +496,20 @@ struct convert<Config>
         node["regexp_date_validation_msg"] = rhs.regexp_date_validation_msg;
         node["regexp_email_validation_msg"] = rhs.regexp_email_validation_msg;
         node["logging_level"] = rhs.logging_level;
+        node["io_service_threads"] = rhs.io_service_threads;
+        node["output_high_water_mark"] = rhs.output_high_water_mark;
+        node["output_drop_limit"] = rhs.output_drop_limit;
+        node["max_nodes"] = rhs.max_nodes;
+        node["max_connections_per_ip"] = rhs.max_connections_per_ip;
+        node["max_accepts_per_second"] = rhs.max_accepts_per_second;
+        node["mccp_compression_level"] = rhs.mccp_compression_level;
+        node["mccp_memory_limit_kb"] = rhs.mccp_memory_limit_kb;
+        node["logon_timeout_minutes"] = rhs.logon_timeout_minutes;
+        node["idle_warning_seconds"] = rhs.idle_warning_seconds;
+        node["keepalive_seconds"] = rhs.keepalive_seconds;
+        node["screen_cache_kb"] = rhs.screen_cache_kb;
+        node["use_listener_reuse_port"] = rhs.use_listener_reuse_port;
+        node["use_posix_sockets"] = rhs.use_posix_sockets;
 
         return node;
     }
@@ -586,6 +632,20 @@ struct convert<Config>
         rhs.regexp_date_validation_msg      = node["regexp_date_validation_msg"].as<std::string>();
         rhs.regexp_email_validation_msg     = node["regexp_email_validation_msg"].as<std::string>();
         rhs.logging_level                   = node["logging_level"].as<std::string>();
+        rhs.io_service_threads              = node["io_service_threads"].as<int>();
+        rhs.output_high_water_mark          = node["output_high_water_mark"].as<int>();
+        rhs.output_drop_limit               = node["output_drop_limit"].as<int>();
+        rhs.max_nodes                       = node["max_nodes"].as<int>();
+        rhs.max_connections_per_ip          = node["max_connections_per_ip"].as<int>();
+        rhs.max_accepts_per_second          = node["max_accepts_per_second"].as<int>();
+        rhs.mccp_compression_level          = node["mccp_compression_level"].as<int>();
+        rhs.mccp_memory_limit_kb            = node["mccp_memory_limit_kb"].as<int>();
+        rhs.logon_timeout_minutes           = node["logon_timeout_minutes"].as<int>();
+        rhs.idle_warning_seconds            = node["idle_warning_seconds"].as<int>();
+        rhs.keepalive_seconds               = node["keepalive_seconds"].as<int>();
+        rhs.screen_cache_kb                 = node["screen_cache_kb"].as<int>();
+        rhs.use_listener_reuse_port         = node["use_listener_reuse_port"].as<bool>();
+        rhs.use_posix_sockets               = node["use_posix_sockets"].as<bool>();
         return true;
     }
 };
@@ -18,6 +18,8 @@ extern std::string USERS_DATABASE;
  * @brief Const Key values for global text prompt lookup
  */
 const std::string GLOBAL_PROMPT_PAUSE = "pause";
+const std::string GLOBAL_PROMPT_IDLE_WARNING = "idle_warning";
+const std::string GLOBAL_PROMPT_IDLE_TIMEOUT = "idle_timeout";
 
 
 
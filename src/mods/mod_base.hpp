@@ -8,6 +8,7 @@
 #include "../session_io.hpp"
 #include "../ansi_processor.hpp"
 #include "../encoding.hpp"
+#include "../glyph_span.hpp"
 
 #include <algorithm>
 #include <memory>
@@ -34,6 +35,22 @@ public:
     virtual bool onEnter() = 0;
     virtual bool onExit()  = 0;
 
+    /**
+     * @brief Batched Input, takes one or more glyphs from the run.
+     *        By default a single glyph is passed to update().
+     * @param glyphs
+     */
+    virtual void updateGlyphs(GlyphSpan &glyphs)
+    {
+        std::string glyph;
+        bool is_utf8 = false;
+
+        if(glyphs.next(glyph, is_utf8))
+        {
+            update(glyph, is_utf8);
+        }
+    }
+
     ModBase(session_data_ptr session_data, config_ptr config, ansi_process_ptr ansi_process)
         : m_session_data(session_data)
         , m_config(config)
@@ -29,7 +29,7 @@ public:
         : ModBase(session_data, config, ansi_process)
         , m_session_io(session_data)
         , m_filename("mod_file_editor.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
         , m_mod_function_index(MOD_PROMPT)
         , m_failure_attempts(0)
         , m_is_text_prompt_exist(false)
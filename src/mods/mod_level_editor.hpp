@@ -28,7 +28,7 @@ public:
         : ModBase(session_data, config, ansi_process)
         , m_session_io(session_data)
         , m_filename("mod_level_editor.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
         , m_mod_setup_index(MOD_DISPLAY_LEVEL)
         , m_mod_function_index(MOD_LEVEL_INPUT)
         , m_mod_level_state_index(LEVEL_ADD)
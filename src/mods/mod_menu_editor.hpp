@@ -32,7 +32,7 @@ public:
         : ModBase(session_data, config, ansi_process)
         , m_session_io(session_data)
         , m_filename("mod_menu_editor.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
         , m_mod_setup_index(MOD_DISPLAY_MENU)
         , m_mod_function_index(MOD_MENU_INPUT)
         , m_mod_menu_state_index(MENU_ADD)
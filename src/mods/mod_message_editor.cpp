@@ -30,6 +30,26 @@ bool ModMessageEditor::update(const std::string &character_buffer, const bool &)
     return true;
 }
 
+/**
+ * @brief Batched Input, Typed or Pasted text is echoed as one run.
+ *        Keys and ESC Sequences are passed by glyph.
+ * @param glyphs
+ */
+void ModMessageEditor::updateGlyphs(GlyphSpan &glyphs)
+{
+    std::string text;
+
+    if(m_is_active && m_mod_function_index == MOD_PROMPT &&
+            !m_session_io.m_common_io.isEscapeSequencePending() &&
+            glyphs.takeTextRun(text))
+    {
+        baseProcessDeliverInput(text);
+        return;
+    }
+
+    ModBase::updateGlyphs(glyphs);
+}
+
 /**
  * @brief Start-up class, setup and display initial screens / interface.
  * @return
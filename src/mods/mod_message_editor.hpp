@@ -30,7 +30,7 @@ public:
         : ModBase(session_data, config, ansi_process)
         , m_session_io(session_data)
         , m_filename("mod_message_editor.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
         , m_mod_function_index(MOD_PROMPT)
         , m_mod_setup_index(MOD_DISPLAY_EDITOR)
         , m_mod_user_state_index(MOD_FSE_INPUT)
@@ -69,6 +69,7 @@ public:
     }
 
     virtual bool update(const std::string &character_buffer, const bool &) override;
+    virtual void updateGlyphs(GlyphSpan &glyphs) override;
     virtual bool onEnter() override;
     virtual bool onExit() override;
 
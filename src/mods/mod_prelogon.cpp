@@ -275,6 +275,11 @@ bool ModPreLogon::emulationDetection(const std::string &input)
                 // Make sure anything piggy backing doesn't reset
                 // Once were detected.
                 m_is_esc_detected = false;
+
+                // Response is complete, no need to wait out the timer.
+                m_deadline_timer->cancel();
+                emulationCompleted();
+                return true;
             }
             else
             {
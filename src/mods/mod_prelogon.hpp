@@ -39,8 +39,8 @@ public:
         : ModBase(session_data, config, ansi_process)
         , m_session_io(session_data)
         , m_filename("mod_prelogon.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
-        , m_deadline_timer(new DeadlineTimer())
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
+        , m_deadline_timer(makeArenaShared<DeadlineTimer>(session_data->m_session_arena, session_data->m_io_service))
         , m_mod_function_index(MOD_DETECT_EMULATION)
         , m_is_text_prompt_exist(false)
         , m_is_esc_detected(false)
@@ -186,10 +186,19 @@ public:
     void startDetectionTimer()
     {
         // Add Deadline Timer for 1.5 seconds for complete Telopt Sequences reponses
+        // Weak, so a client that never answers doesn't keep the module alive.
+        std::weak_ptr<ModPreLogon> weak_prelogon = shared_from_this();
+
         m_deadline_timer->setWaitInMilliseconds(1500);
-        m_deadline_timer->asyncWait(
-            std::bind(&ModPreLogon::handleDetectionTimer, shared_from_this())
-        );
+        m_deadline_timer->asyncWait([weak_prelogon](int)
+        {
+            std::shared_ptr<ModPreLogon> prelogon = weak_prelogon.lock();
+
+            if(prelogon)
+            {
+                prelogon->handleDetectionTimer();
+            }
+        });
     }
 
     /**
@@ -7,7 +7,6 @@
 #include "../encryption.hpp"
 #include "../logging.hpp"
 
-#include <regex>
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -974,46 +973,35 @@ bool ModSignup::birthday(const std::string &input)
 
         baseProcessDeliverNewLine();
 
-        try
+        if(m_session_io.checkRegex(key, m_config->regexp_date_validation))
         {
-            std::regex date_regex { m_config->regexp_date_validation };
-            std::smatch str_matches;
+            // Append Time For Date.
+            key += " 00:00:00";
+            struct std::tm tm;
 
-            if(std::regex_match(key, str_matches, date_regex))
-            {
-                // Append Time For Date.
-                key += " 00:00:00";
-                struct std::tm tm;
-
-                /**
-                 * Only GCC 5.1 + Compatible
-                 * Were no longer using boost, so bye bye 4.9 compat for now.
-                 */
-                std::istringstream ss(key);
-                ss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
-
-                if(ss.fail())
-                {
-                    ss.clear();
-                    displayPromptAndNewLine(PROMPT_DATE_INVALID);
-                    redisplayModulePrompt();
-                    return true;
-                }
-
-                std::time_t const time = mktime(&tm);
-                m_user_record->dtBirthday = time;
-                changeNextModule();
-            }
-            else
+            /**
+             * Only GCC 5.1 + Compatible
+             * Were no longer using boost, so bye bye 4.9 compat for now.
+             */
+            std::istringstream ss(key);
+            ss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
+
+            if(ss.fail())
             {
+                ss.clear();
                 displayPromptAndNewLine(PROMPT_DATE_INVALID);
                 redisplayModulePrompt();
+                return true;
             }
+
+            std::time_t const time = mktime(&tm);
+            m_user_record->dtBirthday = time;
+            changeNextModule();
         }
-        catch(std::regex_error &ex)
+        else
         {
-            Logging *log = Logging::instance();
-            log->xrmLog<Logging::ERROR_LOG>("Error, regex date error=", ex.what(), ex.code(), __LINE__, __FILE__);
+            displayPromptAndNewLine(PROMPT_DATE_INVALID);
+            redisplayModulePrompt();
         }
     }
     else
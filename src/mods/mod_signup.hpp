@@ -40,7 +40,7 @@ public:
         , m_session_io(session_data)
         , m_menu_base(new MenuBase(session_data))
         , m_filename("mod_signup.yaml")
-        , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
+        , m_text_prompts_dao(makeArenaShared<TextPromptsDao>(session_data->m_session_arena, GLOBAL_DATA_PATH, m_filename))
         , m_user_record(new Users())
         , m_security_record(new Security())
         , m_mod_function_index(MOD_NUP)
@@ -11,7 +11,6 @@
 #include <string>
 #include <vector>
 #include <cassert>
-#include <regex>
 
 /**
  * NOTE, changes to password and challenge q/a are saved right away to security record
@@ -1477,11 +1476,8 @@ void ModUserEditor::userEditorFieldHandler(const std::string &input)
             case 'H': // User Birth Date
                 {
                     // Make sure Date Format is valid
-                    std::regex date_regex { m_config->regexp_date_validation };
-                    std::smatch str_matches;
-
                     // If invalid display message, but for now ignore changes
-                    if(std::regex_match(key, str_matches, date_regex))
+                    if(m_session_io.checkRegex(key, m_config->regexp_date_validation))
                     {
                         m_loaded_user.back()->dtBirthday = m_common_io.stringToStandardDate(key);
                     }
@@ -1675,11 +1671,8 @@ void ModUserEditor::userEditorExtendedFieldHandler(const std::string &input)
             case 'B': // Password Last change date
                 {
                     // Make sure Date Format is valid
-                    std::regex date_regex { m_config->regexp_date_validation };
-                    std::smatch str_matches;
-
                     // If invalid display message, but for now ignore changes
-                    if(std::regex_match(key, str_matches, date_regex))
+                    if(m_session_io.checkRegex(key, m_config->regexp_date_validation))
                     {
                         m_loaded_user.back()->dtFirstOn = m_common_io.stringToStandardDate(key);
                     }
@@ -1694,11 +1687,8 @@ void ModUserEditor::userEditorExtendedFieldHandler(const std::string &input)
             case 'C': // Signup Date / First On
                 {
                     // Make sure Date Format is valid
-                    std::regex date_regex { m_config->regexp_date_validation };
-                    std::smatch str_matches;
-
                     // If invalid display message, but for now ignore changes
-                    if(std::regex_match(key, str_matches, date_regex))
+                    if(m_session_io.checkRegex(key, m_config->regexp_date_validation))
                     {
                         m_loaded_user.back()->dtPassChangeDate = m_common_io.stringToStandardDate(key);
                     }
@@ -1713,11 +1703,8 @@ void ModUserEditor::userEditorExtendedFieldHandler(const std::string &input)
             case 'D': // Expiratrion Date
                 {
                     // Make sure Date Format is valid
-                    std::regex date_regex { m_config->regexp_date_validation };
-                    std::smatch str_matches;
-
                     // If invalid display message, but for now ignore changes
-                    if(std::regex_match(key, str_matches, date_regex))
+                    if(m_session_io.checkRegex(key, m_config->regexp_date_validation))
                     {
                         m_loaded_user.back()->dtExpirationDate = m_common_io.stringToStandardDate(key);
                     }
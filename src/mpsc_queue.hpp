@@ -0,0 +1,139 @@
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+
+/**
+ * @class MpscQueue
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file mpsc_queue.hpp
+ * @brief Lock-Free Multi-Producer, Single-Consumer Queue (Intrusive Node, Vyukov)
+ *        Any thread can push without waiting on another, only the owning
+ *        thread (IOService loop) can pop.
+ */
+template <class T>
+class MpscQueue
+{
+public:
+    explicit MpscQueue(void)
+        : m_stub()
+        , m_head(&m_stub)
+        , m_tail(&m_stub)
+    {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue(void)
+    {
+        T item;
+
+        while(pop(item))
+        {
+        }
+    }
+
+    // Add Item to Queue, safe from any thread.
+    void push(T item)
+    {
+        Node *node = new Node();
+        node->m_value = std::move(item);
+        link(node);
+    }
+
+    // Remove the oldest item, consumer thread only.
+    // Returns false if empty, or a push is still linking it's node.
+    bool pop(T &item)
+    {
+        Node *tail = m_tail;
+        Node *next = tail->m_next.load(std::memory_order_acquire);
+
+        // Skip past the stub node.
+        if(tail == &m_stub)
+        {
+            if(next == nullptr)
+            {
+                return false;
+            }
+
+            m_tail = next;
+            tail = next;
+            next = next->m_next.load(std::memory_order_acquire);
+        }
+
+        if(next != nullptr)
+        {
+            m_tail = next;
+            return release(tail, item);
+        }
+
+        // Last node, only remove it when no push is in progress.
+        if(tail != m_head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        link(&m_stub);
+        next = tail->m_next.load(std::memory_order_acquire);
+
+        if(next != nullptr)
+        {
+            m_tail = next;
+            return release(tail, item);
+        }
+
+        return false;
+    }
+
+    // Check if there is nothing to pop, consumer thread only.
+    bool isEmpty(void) const
+    {
+        return m_tail == &m_stub && m_stub.m_next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // Clear out the Entire Queue, consumer thread only.
+    void clear(void)
+    {
+        T item;
+
+        while(pop(item))
+        {
+        }
+    }
+
+private:
+
+    struct Node
+    {
+        Node()
+            : m_next(nullptr)
+            , m_value()
+        {}
+
+        std::atomic<Node *> m_next;
+        T                   m_value;
+    };
+
+    // Producers only exchange the head, then link the previous node to the new one.
+    void link(Node *node)
+    {
+        node->m_next.store(nullptr, std::memory_order_relaxed);
+        Node *previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->m_next.store(node, std::memory_order_release);
+    }
+
+    bool release(Node *node, T &item)
+    {
+        item = std::move(node->m_value);
+        delete node;
+        return true;
+    }
+
+    Node                m_stub;
+    std::atomic<Node *> m_head;
+    Node               *m_tail;
+};
+
+#endif // MPSC_QUEUE_HPP
@@ -0,0 +1,120 @@
+#ifndef NODE_ALLOCATOR_HPP
+#define NODE_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class NodeAllocator
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file node_allocator.hpp
+ * @brief Bitmap of Node Numbers in use, Node 1 is bit 0.
+ *        The lowest free node is picked a word at a time, so the
+ *        search stays short with hundreds of nodes online.
+ *        Thread Safe, nodes are taken and freed from each IOService loop.
+ */
+class NodeAllocator
+{
+public:
+
+    static const int BITS_PER_WORD = 64;
+
+    NodeAllocator()
+        : m_node_bitmap()
+        , m_nodes_in_use(0)
+        , m_node_mutex()
+    {
+    }
+
+    /**
+     * @brief Takes the lowest free node number.
+     * @return
+     */
+    int allocate()
+    {
+        std::lock_guard<std::mutex> lock(m_node_mutex);
+
+        std::vector<uint64_t>::size_type word = 0;
+
+        while(word < m_node_bitmap.size() && m_node_bitmap[word] == ~UINT64_C(0))
+        {
+            ++word;
+        }
+
+        if(word == m_node_bitmap.size())
+        {
+            m_node_bitmap.push_back(0);
+        }
+
+        int bit = lowestFreeBit(m_node_bitmap[word]);
+        m_node_bitmap[word] |= (UINT64_C(1) << bit);
+        ++m_nodes_in_use;
+
+        return static_cast<int>(word * BITS_PER_WORD) + bit + 1;
+    }
+
+    /**
+     * @brief Returns a node number on disconnect, unknown nodes are ignored.
+     * @param node_number
+     */
+    void release(int node_number)
+    {
+        if(node_number < 1)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_node_mutex);
+
+        std::vector<uint64_t>::size_type word = (node_number - 1) / BITS_PER_WORD;
+        uint64_t mask = UINT64_C(1) << ((node_number - 1) % BITS_PER_WORD);
+
+        if(word < m_node_bitmap.size() && (m_node_bitmap[word] & mask))
+        {
+            m_node_bitmap[word] &= ~mask;
+            --m_nodes_in_use;
+        }
+    }
+
+    /**
+     * @brief Number of nodes in use.
+     * @return
+     */
+    int getNodesInUse() const
+    {
+        std::lock_guard<std::mutex> lock(m_node_mutex);
+        return m_nodes_in_use;
+    }
+
+private:
+
+    /**
+     * @brief Index of the lowest clear bit, the word can't be full.
+     * @param word
+     * @return
+     */
+    static int lowestFreeBit(uint64_t word)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(~word);
+#else
+        int bit = 0;
+
+        while(word & 1)
+        {
+            word >>= 1;
+            ++bit;
+        }
+
+        return bit;
+#endif
+    }
+
+    std::vector<uint64_t> m_node_bitmap;
+    int                   m_nodes_in_use;
+    mutable std::mutex    m_node_mutex;
+};
+
+#endif // NODE_ALLOCATOR_HPP
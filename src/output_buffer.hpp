@@ -0,0 +1,56 @@
+#ifndef OUTPUT_BUFFER_HPP
+#define OUTPUT_BUFFER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+/**
+ * Immutable Output, shared between the Write Jobs and Socket Queues that send it.
+ * Broadcasts are rendered once and referenced by every connection's queue.
+ */
+typedef std::shared_ptr<const std::string> output_buffer_ptr;
+typedef std::deque<output_buffer_ptr>      output_buffer_queue;
+
+/**
+ * @brief Job String Sequences to Output Buffers, shared buffers pass through as is.
+ * @param data
+ * @return
+ */
+inline output_buffer_ptr makeOutputBuffer(const std::string &data)
+{
+    return std::make_shared<const std::string>(data);
+}
+
+inline output_buffer_ptr makeOutputBuffer(const output_buffer_ptr &buffer)
+{
+    return buffer;
+}
+
+inline output_buffer_ptr makeOutputBuffer(std::nullptr_t)
+{
+    return nullptr;
+}
+
+/**
+ * @brief Output Buffers back to String Sequences, for jobs that read them as text.
+ * @param data
+ * @return
+ */
+inline std::string makeStringSequence(const std::string &data)
+{
+    return data;
+}
+
+inline std::string makeStringSequence(const output_buffer_ptr &buffer)
+{
+    return buffer ? *buffer : std::string();
+}
+
+inline std::string makeStringSequence(std::nullptr_t)
+{
+    return std::string();
+}
+
+#endif // OUTPUT_BUFFER_HPP
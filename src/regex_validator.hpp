@@ -0,0 +1,93 @@
+#ifndef REGEX_VALIDATOR_HPP
+#define REGEX_VALIDATOR_HPP
+
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+
+typedef std::shared_ptr<const std::regex> regex_ptr;
+
+/**
+ * @class RegexValidator
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file regex_validator.hpp
+ * @brief Registry of compiled Expressions, Config Validations and Code Maps.
+ *        Each expression is compiled once, at startup or on first use, and
+ *        shared between all threads.  Matching on a const regex is Thread Safe.
+ *        Expressions that fail to compile are kept as nullptr so they never match
+ *        and the error is only reported the first time.
+ */
+class RegexValidator
+{
+public:
+
+    /**
+     * @brief Compiled Expression from the registry, or compile and register it.
+     * @param expression
+     * @param error - Set only when this call compiled it and it failed.
+     * @return nullptr if the expression is invalid.
+     */
+    static regex_ptr getExpression(const std::string &expression, std::string &error)
+    {
+        std::lock_guard<std::mutex> lock(getMutex());
+        auto &registry = getRegistry();
+        auto it = registry.find(expression);
+
+        if(it != registry.end())
+        {
+            return it->second;
+        }
+
+        regex_ptr compiled = nullptr;
+
+        try
+        {
+            compiled = std::make_shared<const std::regex>(expression);
+        }
+        catch(std::regex_error &ex)
+        {
+            error = ex.what();
+        }
+
+        registry[expression] = compiled;
+        return compiled;
+    }
+
+    /**
+     * @brief Full match of the sequence to the expression.
+     * @param sequence
+     * @param expression
+     * @param error - Set only the first time an invalid expression is used.
+     * @return
+     */
+    static bool match(const std::string &sequence, const std::string &expression, std::string &error)
+    {
+        regex_ptr compiled = getExpression(expression, error);
+
+        if(!compiled)
+        {
+            return false;
+        }
+
+        return std::regex_match(sequence, *compiled);
+    }
+
+private:
+
+    static std::mutex &getMutex()
+    {
+        static std::mutex registry_mutex;
+        return registry_mutex;
+    }
+
+    static std::unordered_map<std::string, regex_ptr> &getRegistry()
+    {
+        static std::unordered_map<std::string, regex_ptr> registry;
+        return registry;
+    }
+};
+
+#endif // REGEX_VALIDATOR_HPP
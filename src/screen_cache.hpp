@@ -0,0 +1,277 @@
+#ifndef SCREEN_CACHE_HPP
+#define SCREEN_CACHE_HPP
+
+#include "encoding.hpp"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <ctime>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+typedef std::shared_ptr<const std::string> screen_buffer_ptr;
+
+/**
+ * @class ScreenCache
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file screen_cache.hpp
+ * @brief Process wide cache of ANSI / ASCII Screens keyed by path.
+ *        Screens are read in one go, new lines are normalized and the text is
+ *        encoded to UTF-8 once, then shared by every node that displays them.
+ *        Each lookup checks the file's modified time, to the nanosecond where the
+ *        platform has it, and size, so edited screens are reloaded.  Least recently
+ *        used screens are dropped to stay in the memory limit.  Thread Safe.
+ */
+class ScreenCache
+{
+public:
+
+    static const std::size_t DEFAULT_MEMORY_LIMIT = 8192 * 1024;
+
+    static ScreenCache *instance()
+    {
+        static ScreenCache screen_cache;
+        return &screen_cache;
+    }
+
+    /**
+     * @brief Memory for cached screens, 0 disables caching.
+     * @param bytes
+     */
+    void setMemoryLimit(std::size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memory_limit = bytes;
+        evictToLimit();
+    }
+
+    /**
+     * @brief Normalized and UTF-8 Encoded Screen, (re)loaded when the file has changed.
+     * @param path - Full path to the screen.
+     * @return nullptr if the file can't be read.
+     */
+    screen_buffer_ptr getScreen(const std::string &path)
+    {
+        struct stat file_status;
+
+        if(stat(path.c_str(), &file_status) != 0 || S_ISDIR(file_status.st_mode))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            removeEntry(path);
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_entries.find(path);
+
+            if(it != m_entries.end())
+            {
+                if(it->second.m_modified == file_status.st_mtime &&
+                        it->second.m_modified_nsec == modifiedNanoseconds(file_status) &&
+                        it->second.m_file_size == file_status.st_size)
+                {
+                    m_lru.splice(m_lru.begin(), m_lru, it->second.m_lru_position);
+                    return it->second.m_screen;
+                }
+
+                removeEntry(path);
+            }
+        }
+
+        // Loaded outside the lock, if another node beats us to it either is fine.
+        screen_buffer_ptr screen = loadScreen(path, file_status.st_size);
+
+        if(!screen)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(screen->size() > m_memory_limit || m_entries.find(path) != m_entries.end())
+        {
+            return screen;
+        }
+
+        m_lru.push_front(path);
+
+        CacheEntry entry;
+        entry.m_screen = screen;
+        entry.m_modified = file_status.st_mtime;
+        entry.m_modified_nsec = modifiedNanoseconds(file_status);
+        entry.m_file_size = file_status.st_size;
+        entry.m_lru_position = m_lru.begin();
+
+        m_entries[path] = entry;
+        m_bytes_cached += screen->size();
+        evictToLimit();
+
+        return screen;
+    }
+
+    /**
+     * @brief Bytes held by cached screens.
+     * @return
+     */
+    std::size_t getBytesCached() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes_cached;
+    }
+
+    /**
+     * @brief Drop all cached screens.
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_lru.clear();
+        m_bytes_cached = 0;
+    }
+
+    /**
+     * @brief Each run of CR and LF is folded to a single CR\LF for consistent display.
+     * @param data
+     * @return
+     */
+    static std::string normalizeNewLines(const std::string &data)
+    {
+        std::string output = "";
+        output.reserve(data.size() + (data.size() / 32));
+        std::string::size_type position = 0;
+
+        while(position < data.size())
+        {
+            std::string::size_type new_line = data.find_first_of("\r\n", position);
+
+            if(new_line == std::string::npos)
+            {
+                output.append(data, position, std::string::npos);
+                break;
+            }
+
+            output.append(data, position, new_line - position);
+            output.append("\r\n");
+
+            position = data.find_first_not_of("\r\n", new_line);
+
+            if(position == std::string::npos)
+            {
+                break;
+            }
+        }
+
+        return output;
+    }
+
+private:
+
+    ScreenCache()
+        : m_entries()
+        , m_lru()
+        , m_bytes_cached(0)
+        , m_memory_limit(DEFAULT_MEMORY_LIMIT)
+        , m_mutex()
+    {
+    }
+
+    ScreenCache(const ScreenCache&) = delete;
+    ScreenCache& operator=(const ScreenCache&) = delete;
+
+    struct CacheEntry
+    {
+        screen_buffer_ptr                m_screen;
+        std::time_t                      m_modified;
+        long                             m_modified_nsec;
+        off_t                            m_file_size;
+        std::list<std::string>::iterator m_lru_position;
+    };
+
+    /**
+     * @brief Nanoseconds of the modified time, edits within the same second
+     *        that keep the size are still seen.  0 where it's not available.
+     * @param file_status
+     * @return
+     */
+    static long modifiedNanoseconds(const struct stat &file_status)
+    {
+#ifdef __linux__
+        return file_status.st_mtim.tv_nsec;
+#elif defined(TARGET_OS_MAC)
+        return file_status.st_mtimespec.tv_nsec;
+#else
+        (void)file_status;
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Read the whole file in one go, then normalize and encode it.
+     * @param path
+     * @param file_size
+     * @return
+     */
+    static screen_buffer_ptr loadScreen(const std::string &path, off_t file_size)
+    {
+        FILE *fp = fopen(path.c_str(), "rb");
+
+        if(fp == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::string buffer(static_cast<std::string::size_type>(file_size), '\0');
+        std::size_t bytes_read = buffer.empty() ? 0 : fread(&buffer[0], 1, buffer.size(), fp);
+        fclose(fp);
+
+        // File could be shrinking while it's being written out.
+        buffer.resize(bytes_read);
+
+        return std::make_shared<const std::string>(
+                   Encoding::instance()->utf8Encode(normalizeNewLines(buffer)));
+    }
+
+    /**
+     * @brief Remove a screen from the cache, lock must be held.
+     * @param path
+     */
+    void removeEntry(const std::string &path)
+    {
+        auto it = m_entries.find(path);
+
+        if(it != m_entries.end())
+        {
+            m_bytes_cached -= it->second.m_screen->size();
+            m_lru.erase(it->second.m_lru_position);
+            m_entries.erase(it);
+        }
+    }
+
+    /**
+     * @brief Drop the least recently used screens until under the limit, lock must be held.
+     */
+    void evictToLimit()
+    {
+        while(m_bytes_cached > m_memory_limit && !m_lru.empty())
+        {
+            std::string path = m_lru.back();
+            removeEntry(path);
+        }
+    }
+
+    std::unordered_map<std::string, CacheEntry> m_entries;
+    std::list<std::string>                      m_lru;
+    std::size_t                                 m_bytes_cached;
+    std::size_t                                 m_memory_limit;
+    mutable std::mutex                          m_mutex;
+};
+
+#endif // SCREEN_CACHE_HPP
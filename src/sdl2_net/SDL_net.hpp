@@ -195,6 +195,17 @@ int SDLCALL SDLNet_TCP_Recv(TCPsocket sock, void *data, int maxlen);
 /* Close a TCP network socket */
 void SDLCALL SDLNet_TCP_Close(TCPsocket sock);
 
+/* Get the underlying socket descriptor, used for registering with epoll.
+   (Oblivion/2 XRM addition, not part of upstream SDL_net)
+*/
+int SDLCALL SDLNet_TCP_GetSocketId(TCPsocket sock);
+
+/* Open a local server socket on the given port, same as SDLNet_TCP_Open()
+   with SO_REUSEPORT set first when 'reuse_port' is non-zero (if supported).
+   (Oblivion/2 XRM addition, not part of upstream SDL_net)
+*/
+TCPsocket SDLCALL SDLNet_TCP_OpenServer(IPaddress *ip, int reuse_port);
+
 
 /***********************************************************************/
 /* UDP network API                                                     */
@@ -43,7 +43,23 @@ struct _TCPsocket {
    otherwise a TCP connection to the remote host and port is attempted.
    The newly created socket is returned, or NULL if there was an error.
 */
+static TCPsocket SDLNet_TCP_OpenSocket(IPaddress *ip, int reuse_port);
+
 TCPsocket SDLNet_TCP_Open(IPaddress *ip)
+{
+    return SDLNet_TCP_OpenSocket(ip, 0);
+}
+
+/* Open a local server socket, with SO_REUSEPORT set when 'reuse_port' is
+   non-zero so more then one socket can listen on the same port.
+   (Oblivion/2 XRM addition, not part of upstream SDL_net)
+*/
+TCPsocket SDLNet_TCP_OpenServer(IPaddress *ip, int reuse_port)
+{
+    return SDLNet_TCP_OpenSocket(ip, reuse_port);
+}
+
+static TCPsocket SDLNet_TCP_OpenSocket(IPaddress *ip, int reuse_port)
 {
     TCPsocket sock;
     struct sockaddr_in sock_addr;
@@ -100,13 +116,26 @@ TCPsocket SDLNet_TCP_Open(IPaddress *ip)
         }
 #endif
 
+#ifdef SO_REUSEPORT
+        /* allow a listener per thread on the same port, kernel balances accepts */
+        if ( reuse_port ) {
+            int yes = 1;
+            if ( setsockopt(sock->channel, SOL_SOCKET, SO_REUSEPORT, (char*)&yes, sizeof(yes)) == SOCKET_ERROR ) {
+                SDLNet_SetError("Couldn't set SO_REUSEPORT");
+                goto error_return;
+            }
+        }
+#else
+        (void)reuse_port;
+#endif
+
         /* Bind the socket for listening */
         if ( bind(sock->channel, (struct sockaddr *)&sock_addr,
                 sizeof(sock_addr)) == SOCKET_ERROR ) {
             SDLNet_SetError("Couldn't bind to local port");
             goto error_return;
         }
-        if ( listen(sock->channel, 5) == SOCKET_ERROR ) {
+        if ( listen(sock->channel, SOMAXCONN) == SOCKET_ERROR ) {
             SDLNet_SetError("Couldn't listen to local port");
             goto error_return;
         }
@@ -300,3 +329,14 @@ void SDLNet_TCP_Close(TCPsocket sock)
         SDL_free(sock);
     }
 }
+
+/* Get the underlying socket descriptor, used for registering with epoll.
+   (Oblivion/2 XRM addition, not part of upstream SDL_net)
+*/
+int SDLNet_TCP_GetSocketId(TCPsocket sock)
+{
+    if ( sock == NULL ) {
+        return(-1);
+    }
+    return((int)sock->channel);
+}
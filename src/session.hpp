@@ -45,6 +45,13 @@ public:
 
         // Free the menu system state and modules when session closes.
         m_state_manager->clean();
+
+        if(m_session_data->m_session_arena)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::DEBUG_LOG>("Session arena bytes used=", m_session_data->m_session_arena->getBytesUsed(),
+                                            "reserved=", m_session_data->m_session_arena->getBytesReserved());
+        }
     }
 
     /**
@@ -52,17 +59,22 @@ public:
      *        Telnet Option Negotiation with the client.
      * @param tcp_connection
      * @param session_manager
+     * @param session_arena - Session objects are allocated from it when set.
      * @return
      */
     static session_ptr create(IOService& io_service, connection_ptr connection, deadline_timer_ptr deadline_timer,
-                              session_manager_ptr session_manager)
+                              session_manager_ptr session_manager, session_arena_ptr session_arena = nullptr)
     {
-        session_ptr new_session(new Session(io_service, connection, deadline_timer, session_manager));
+        session_ptr new_session = makeArenaShared<Session>(session_arena, io_service, connection, deadline_timer,
+                                  session_manager, session_arena);
 
         if(connection->isActive())
         {
             new_session->m_session_data->startUpSessionStats("Telnet");
             new_session->m_session_data->waitingForData();
+
+            // Idle and Logon Timeouts, Keepalives for connections that are gone.
+            new_session->m_session_data->startIdleTimer();
         }
 
         // Send out Telnet Negoiation Options
@@ -105,11 +117,20 @@ public:
             new_session->m_session_data->m_telnet_state->sendIACSequences(DO, TELOPT_NAWS);
             new_session->m_session_data->m_telnet_state->addReply(TELOPT_NAWS);
 
+            // Offer MCCP2, output is compressed once the client replies DO.
+            config_ptr config = TheCommunicator::instance()->getConfiguration();
+
+            if(config && config->mccp_compression_level > 0)
+            {
+                new_session->m_session_data->m_telnet_state->sendIACSequences(WILL, TELOPT_MCCP_2);
+                new_session->m_session_data->m_telnet_state->addReply(TELOPT_MCCP_2);
+            }
+
             // No replies, this can really not be used, only informational.
             //new_session->m_session_data->m_telnet_state->sendIACSequences(DO, TELOPT_NEW_ENVIRON);
             //new_session->m_session_data->m_telnet_state->addReply(TELOPT_NEW_ENVIRON);
 
-            // Wait 1.5 Seconds for respones.
+            // Wait for responses, at most 1.5 Seconds.
             new_session->startDetectionTimer();
         }
 
@@ -117,10 +138,23 @@ public:
     }
 
     /**
-     * @brief Telopt Sequences timer
+     * @brief Telopt Sequences timer, Detection completes when the client
+     *        has answered everything, the timer is for those that don't.
      */
     void startDetectionTimer()
     {
+        // Weak, Session Data is owned by the Session.
+        std::weak_ptr<Session> weak_session = shared_from_this();
+        m_session_data->setNegotiationHandler([weak_session]()
+        {
+            session_ptr session = weak_session.lock();
+
+            if(session)
+            {
+                session->handleDetectionTimer();
+            }
+        });
+
         // Add Deadline Timer for 1.5 seconds for complete Telopt Sequences reponses
         m_deadline_timer->setWaitInMilliseconds(1500);
         m_deadline_timer->asyncWait(
@@ -129,13 +163,23 @@ public:
     }
 
     /**
-     * @brief Deadline Detection Timer for Negoiation
+     * @brief Deadline Detection Timer or all Replies received for Negoiation
      * @param timer
      */
     void handleDetectionTimer()
     {
+        // Only the first of the timer or the last reply starts the state.
+        if(m_is_detection_completed)
+        {
+            return;
+        }
+
+        m_is_detection_completed = true;
+        m_deadline_timer->cancel();
+        m_session_data->setNegotiationHandler(nullptr);
+
         // Detection Completed, start ip the Pre-Logon Sequence State.
-        state_ptr new_state(new MenuSystem(m_session_data));
+        state_ptr new_state = makeArenaShared<MenuSystem>(m_session_data->m_session_arena, m_session_data);
         m_state_manager->changeState(new_state);
     }
 
@@ -174,6 +218,29 @@ public:
         }
     }
 
+    /**
+     * @brief Callback from The Broadcaster with output already encoded for this session.
+     *        The buffer is shared by all sessions on the same encoding and isn't copied.
+     * @param buffer
+     */
+    void deliverBuffer(output_buffer_ptr buffer)
+    {
+        if(!buffer || buffer->empty())
+        {
+            return;
+        }
+
+        if(m_connection->isActive() && TheCommunicator::instance()->isActive())
+        {
+            m_connection->asyncWrite(buffer,
+                                     std::bind(
+                                         &Session::handleWrite,
+                                         shared_from_this(),
+                                         std::placeholders::_1,
+                                         std::placeholders::_2));
+        }
+    }
+
     /**
      * @brief Callback after Writing Data, If error/hangup notifies
      *        Everyone this person has left.
@@ -219,11 +286,13 @@ public:
      * @return
      */
     Session(IOService& io_service, connection_ptr connection, deadline_timer_ptr deadline_timer,
-            session_manager_ptr session_manager)
+            session_manager_ptr session_manager, session_arena_ptr session_arena)
         : m_connection(connection)
-        , m_state_manager(new StateManager())
-        , m_session_data(new SessionData(connection, session_manager, io_service, m_state_manager))
+        , m_state_manager(makeArenaShared<StateManager>(session_arena))
+        , m_session_data(makeArenaShared<SessionData>(session_arena, connection, session_manager, io_service,
+                         m_state_manager, session_arena))
         , m_deadline_timer(deadline_timer)
+        , m_is_detection_completed(false)
     {
         Logging *log = Logging::instance();
 
@@ -249,6 +318,7 @@ public:
     session_data_ptr    m_session_data;
     socket_handler_ptr  m_socket_handler;
     deadline_timer_ptr  m_deadline_timer;
+    bool                m_is_detection_completed;
 
 };
 
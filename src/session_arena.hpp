@@ -0,0 +1,253 @@
+#ifndef SESSION_ARENA_HPP
+#define SESSION_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+class SessionArena;
+typedef std::shared_ptr<SessionArena> session_arena_ptr;
+
+/**
+ * @class SessionArena
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file session_arena.hpp
+ * @brief Memory Pool for Session lifetime objects, carved from large blocks.
+ *        Freed chunks are kept in free lists by size class for reuse, ie..
+ *        Modules and Menus coming and going, and all blocks are released
+ *        in one go when the last object using the arena is gone.
+ *        Objects are mostly used from the session's loop, but a shared_ptr
+ *        can be released from any thread, so it's Thread Safe.
+ */
+class SessionArena
+{
+public:
+
+    static const std::size_t BLOCK_SIZE     = 16384;
+    static const std::size_t MIN_CHUNK_SIZE = 16;
+    static const int         SIZE_CLASSES   = 10;    // 16 bytes to 8k
+
+    SessionArena()
+        : m_blocks()
+        , m_block_position(nullptr)
+        , m_block_remaining(0)
+        , m_bytes_used(0)
+        , m_bytes_reserved(0)
+        , m_mutex()
+    {
+        for(int i = 0; i < SIZE_CLASSES; i++)
+        {
+            m_free_lists[i] = nullptr;
+        }
+    }
+
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+
+    ~SessionArena()
+    {
+        for(auto &block : m_blocks)
+        {
+            ::operator delete(block);
+        }
+    }
+
+    /**
+     * @brief Allocate from the free list or the current block.
+     *        Larger then the largest size class goes to the heap.
+     * @param size
+     * @return
+     */
+    void *allocate(std::size_t size)
+    {
+        int size_class = getSizeClass(size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(size_class < 0)
+        {
+            m_bytes_used += size;
+            return ::operator new(size);
+        }
+
+        std::size_t chunk_size = MIN_CHUNK_SIZE << size_class;
+        m_bytes_used += chunk_size;
+
+        FreeChunk *chunk = m_free_lists[size_class];
+
+        if(chunk)
+        {
+            m_free_lists[size_class] = chunk->m_next;
+            return chunk;
+        }
+
+        if(chunk_size > m_block_remaining)
+        {
+            // What's left of the old block is too small to matter.
+            m_block_position = static_cast<char *>(::operator new(BLOCK_SIZE));
+            m_block_remaining = BLOCK_SIZE;
+            m_bytes_reserved += BLOCK_SIZE;
+            m_blocks.push_back(m_block_position);
+        }
+
+        void *memory = m_block_position;
+        m_block_position += chunk_size;
+        m_block_remaining -= chunk_size;
+        return memory;
+    }
+
+    /**
+     * @brief Return a chunk to it's free list, memory is released with the arena.
+     * @param memory
+     * @param size
+     */
+    void deallocate(void *memory, std::size_t size)
+    {
+        int size_class = getSizeClass(size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(size_class < 0)
+        {
+            m_bytes_used -= size;
+            ::operator delete(memory);
+            return;
+        }
+
+        m_bytes_used -= (MIN_CHUNK_SIZE << size_class);
+
+        FreeChunk *chunk = static_cast<FreeChunk *>(memory);
+        chunk->m_next = m_free_lists[size_class];
+        m_free_lists[size_class] = chunk;
+    }
+
+    /**
+     * @brief Bytes held by live objects of the session.
+     * @return
+     */
+    std::size_t getBytesUsed() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes_used;
+    }
+
+    /**
+     * @brief Bytes of blocks allocated for the session.
+     * @return
+     */
+    std::size_t getBytesReserved() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes_reserved;
+    }
+
+private:
+
+    struct FreeChunk
+    {
+        FreeChunk *m_next;
+    };
+
+    /**
+     * @brief Power of two size class, -1 if it's to large for the pool.
+     * @param size
+     * @return
+     */
+    static int getSizeClass(std::size_t size)
+    {
+        std::size_t chunk_size = MIN_CHUNK_SIZE;
+
+        for(int size_class = 0; size_class < SIZE_CLASSES; size_class++)
+        {
+            if(size <= chunk_size)
+            {
+                return size_class;
+            }
+
+            chunk_size <<= 1;
+        }
+
+        return -1;
+    }
+
+    std::vector<char *> m_blocks;
+    char               *m_block_position;
+    std::size_t         m_block_remaining;
+    std::size_t         m_bytes_used;
+    std::size_t         m_bytes_reserved;
+    FreeChunk          *m_free_lists[SIZE_CLASSES];
+    mutable std::mutex  m_mutex;
+};
+
+/**
+ * @class ArenaAllocator
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file session_arena.hpp
+ * @brief STL Allocator for a Session Arena, used with std::allocate_shared so the
+ *        object and it's control block share one chunk.  Each copy holds the
+ *        arena, so it's kept until the last object from it is released.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+
+    typedef T value_type;
+
+    explicit ArenaAllocator(session_arena_ptr arena)
+        : m_arena(arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : m_arena(other.m_arena)
+    {
+    }
+
+    T *allocate(std::size_t count)
+    {
+        return static_cast<T *>(m_arena->allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T *memory, std::size_t count)
+    {
+        m_arena->deallocate(memory, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const
+    {
+        return m_arena == other.m_arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const
+    {
+        return m_arena != other.m_arena;
+    }
+
+    session_arena_ptr m_arena;
+};
+
+/**
+ * @brief Create a shared object from the Session Arena, or the heap when there is none.
+ * @param arena
+ * @param args
+ * @return
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makeArenaShared(session_arena_ptr arena, Args&&... args)
+{
+    if(!arena)
+    {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+    return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+}
+
+#endif // SESSION_ARENA_HPP
@@ -1,22 +1,33 @@
 #include "session_data.hpp"
 #include "state_manager.hpp"
 #include "session_manager.hpp"
+#include "session_io.hpp"
+#include "communicator.hpp"
 #include "logging.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 
 /**
  * @brief Passed data Though the State, and Checks ESC Timer
  */
 void SessionData::updateState()
 {
-    // Last Character Received is ESC, then Check for
-    // ESC Sequence, or Lone ESC Key.
-    if(m_parsed_data[m_parsed_data.size()-1] == '\x1b')
+    // ESC or ESC Sequence cut off at the end of the packet is held back,
+    // Only the Deadline tells a Lone ESC Key from the rest still coming.
+    if(m_input_sequencer.resolve(m_parsed_data))
     {
         startEscapeTimer();
         m_is_esc_timer = true;
     }
-    else if(!m_is_esc_timer)
+    else if(m_is_esc_timer)
+    {
+        m_esc_input_timer->cancel();
+        m_is_esc_timer = false;
+    }
+
+    if(m_parsed_data.size() > 0)
     {
         m_state_manager->update();
     }
@@ -26,14 +37,22 @@ void SessionData::updateState()
  * @brief Callback after data received. handles telnet options
  * Then parses out normal text data from client to server.
  * @param error
- * @param bytes_transferred
+ * @param socket_handler
  */
-void SessionData::handleRead(const std::error_code& error, socket_handler_ptr)
+void SessionData::handleRead(const std::error_code& error, socket_handler_ptr socket_handler)
 {
-    if(!error)
+    if(!error && socket_handler)
     {
         // Part I: Parse Out Telnet Options and handle responses back to client.
-        handleTeloptCodes();
+        // Data is read straight from the connection's buffer, only the length received.
+        handleTeloptCodes(socket_handler->getReadBuffer(), socket_handler->getReadLength());
+
+        // Only input from the user resets the Idle Timeouts, not Telnet Option replies.
+        if(m_telnet_data.size() > 0)
+        {
+            m_last_input_time = std::chrono::steady_clock::now();
+            m_is_idle_warned = false;
+        }
     }
 
     session_manager_ptr session_manager = m_session_manager.lock();
@@ -50,22 +69,7 @@ void SessionData::handleRead(const std::error_code& error, socket_handler_ptr)
         if(m_parsed_data.size() > 0)
         {
             // Windows Console Telnet sends [CR\LF] for ENTER!
-            // search and replace input buffer we only need one!
-            std::string::size_type id1 = 0;
-
-            do
-            {
-                // Convert CR\LF to LF!
-                id1 = m_parsed_data.find("\r\n", 0);
-
-                if(id1 != std::string::npos)
-                {
-                    m_parsed_data.erase(id1, 1);
-                    id1 = m_parsed_data.find("\r\n", 0);
-                }
-            }
-            while(id1 != std::string::npos);
-
+            // CR and CR\LF are already folded to a single LF by the Input Pipeline.
 
             // If were in a process, skip stat and ESC timer.
             if(m_is_process_running)
@@ -125,6 +129,14 @@ void SessionData::handleRead(const std::error_code& error, socket_handler_ptr)
             }*/
         }
 
+        // Last option was answered, finish Terminal Detection now.
+        if(m_negotiation_handler && m_telnet_state->isNegotiationComplete())
+        {
+            std::function<void()> negotiation_handler = m_negotiation_handler;
+            m_negotiation_handler = nullptr;
+            negotiation_handler();
+        }
+
         // Restart Callback to wait for more data.
         // If this step is skipped, then the node will exit
         // since io_service will have no more work!
@@ -166,9 +178,134 @@ void SessionData::handleRead(const std::error_code& error, socket_handler_ptr)
  */
 void SessionData::handleEscTimer()
 {
-    // Move text to State Machine, Timer has passed, or remainer of Sequence caught up!
-    m_state_manager->update();
+    // Timer has passed, move held input to State Machine, a single ESC is the ESC Key.
     m_is_esc_timer = false;
+    m_input_sequencer.flush(m_parsed_data);
+
+    if(m_parsed_data.size() > 0)
+    {
+        m_state_manager->update();
+    }
+}
+
+/**
+ * @brief Idle Timer, warns then disconnects Idle users, Probes quiet connections.
+ */
+void SessionData::handleIdleTimer()
+{
+    if(m_is_leaving || !m_connection->isActive())
+    {
+        return;
+    }
+
+    config_ptr config = TheCommunicator::instance()->getConfiguration();
+
+    if(!config)
+    {
+        startIdleTimer();
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    long idle_seconds = std::chrono::duration_cast<std::chrono::seconds>(now - m_last_input_time).count();
+
+    // Users have the system's timeout once logged in, before that it's the logon timeout.
+    long timeout_seconds = (m_is_session_authorized ? config->default_user_timeout : config->logon_timeout_minutes) * 60L;
+
+    if(timeout_seconds > 0)
+    {
+        if(idle_seconds >= timeout_seconds)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::CONSOLE_LOG>("Idle timeout, disconnecting Node=", m_node_number, "idle seconds=", idle_seconds);
+
+            std::string message = getGlobalPromptText(GLOBAL_PROMPT_IDLE_TIMEOUT,
+                                  "\r\n\x1b[1;31mInactivity timeout, \x1b[0;36mdisconnecting.\x1b[0m\r\n");
+
+            // Disconnect after the message is written, the timer isn't restarted.
+            m_connection->asyncWrite(message,
+                                     std::bind(
+                                         &SessionData::handleIdleDisconnect,
+                                         shared_from_this(),
+                                         std::placeholders::_1,
+                                         std::placeholders::_2));
+            return;
+        }
+
+        if(!m_is_idle_warned && config->idle_warning_seconds > 0 &&
+                idle_seconds >= timeout_seconds - config->idle_warning_seconds)
+        {
+            m_is_idle_warned = true;
+            m_connection->asyncWrite(getGlobalPromptText(GLOBAL_PROMPT_IDLE_WARNING,
+                                     "\r\n\x1b[1;31mAre you still there? \x1b[0;36mHit a key or you will be disconnected.\x1b[0m\r\n"),
+                                     std::bind(
+                                         &SessionData::handleWrite,
+                                         shared_from_this(),
+                                         std::placeholders::_1,
+                                         std::placeholders::_2));
+        }
+    }
+
+    // Nothing from the client in a while, IAC NOP is ignored by clients, but a
+    // Connection that is gone fails the write (or TCP Keepalive) and is reclaimed.
+    if(config->keepalive_seconds > 0)
+    {
+        std::chrono::steady_clock::time_point last_activity = std::max(m_last_input_time, m_last_keepalive_time);
+
+        if(std::chrono::duration_cast<std::chrono::seconds>(now - last_activity).count() >= config->keepalive_seconds)
+        {
+            m_last_keepalive_time = now;
+
+            std::string keepalive = { static_cast<char>(IAC), static_cast<char>(NOP) };
+            m_connection->asyncWrite(keepalive,
+                                     std::bind(
+                                         &SessionData::handleWrite,
+                                         shared_from_this(),
+                                         std::placeholders::_1,
+                                         std::placeholders::_2));
+        }
+    }
+
+    startIdleTimer();
+}
+
+/**
+ * @brief Callback after the Timeout Message is written, then disconnect.
+ * @param error
+ */
+void SessionData::handleIdleDisconnect(const std::error_code&, socket_handler_ptr)
+{
+    if(!m_is_leaving)
+    {
+        m_is_leaving = true;
+        logoff();
+    }
+}
+
+/**
+ * @brief Global Prompt translated to ANSI, or the default when it's missing.
+ * @param lookup
+ * @param default_prompt
+ * @return
+ */
+std::string SessionData::getGlobalPromptText(const std::string &lookup, const std::string &default_prompt)
+{
+    M_StringPair prompt = TheCommunicator::instance()->getGlobalPrompt(lookup);
+    std::string output = default_prompt;
+
+    if(prompt.second.size() > 0)
+    {
+        SessionIO session_io(shared_from_this());
+        output = session_io.pipe2ansi(prompt.second);
+    }
+
+    // On Output, We have internal UTF8 now, translate to CP437
+    if(m_encoding == Encoding::ENCODE_CP437)
+    {
+        output = Encoding::instance()->utf8Decode(output);
+    }
+
+    return output;
 }
 
 /**
@@ -15,6 +15,9 @@
 #include "session_manager.hpp"
 #include "common_io.hpp"
 #include "deadline_timer.hpp"
+#include "input_normalizer.hpp"
+#include "input_sequencer.hpp"
+#include "session_arena.hpp"
 #include "logging.hpp"
 
 #include "model-sys/structures.hpp"
@@ -29,6 +32,8 @@
 
 #include <memory>
 #include <string>
+#include <chrono>
+#include <atomic>
 
 class StateManager;
 typedef std::shared_ptr<StateManager> state_manager_ptr;
@@ -52,17 +57,20 @@ public:
     SessionData(connection_ptr           connection,
                 session_manager_ptr      room,
                 IOService&               io_service,
-                state_manager_ptr        state_manager)
+                state_manager_ptr        state_manager,
+                session_arena_ptr        session_arena = nullptr)
         : m_connection(connection)
         , m_session_manager(room)
-        , m_telnet_state(new TelnetDecoder(connection))
-        , m_esc_input_timer(new DeadlineTimer())
+        , m_session_arena(session_arena)
+        , m_telnet_state(makeArenaShared<TelnetDecoder>(session_arena, connection))
+        , m_esc_input_timer(makeArenaShared<DeadlineTimer>(session_arena, io_service))
+        , m_idle_timer(makeArenaShared<DeadlineTimer>(session_arena, io_service))
         , m_state_manager(state_manager)
         , m_io_service(io_service)
         , m_common_io()
         , m_user_database(USERS_DATABASE, &m_database_log)
-        , m_user_record(new Users())
-        , m_session_stats(new SessionStats())
+        , m_user_record(makeArenaShared<Users>(session_arena))
+        , m_session_stats(makeArenaShared<SessionStats>(session_arena))
         , m_node_number(0)
         , m_is_use_ansi(true)
         , m_encoding_text(Encoding::ENCODING_TEXT_UTF8)
@@ -72,6 +80,13 @@ public:
         , m_is_esc_timer(false)
         , m_is_process_running(false)
         , m_parsed_data("")
+        , m_negotiation_handler(nullptr)
+        , m_input_sequencer()
+        , m_input_normalizer()
+        , m_telnet_data("")
+        , m_last_input_time(std::chrono::steady_clock::now())
+        , m_last_keepalive_time(m_last_input_time)
+        , m_is_idle_warned(false)
     {
     }
 
@@ -90,14 +105,9 @@ public:
      */
     void waitingForData()
     {
-        // Important, clear out buffer before each read.
-        //memset(&m_raw_data, 0, max_length);
-        std::vector<unsigned char>().swap(m_in_data_vector);
-
         if(m_connection->isActive() && TheCommunicator::instance()->isActive())
         {
-            m_connection->asyncRead(m_in_data_vector,
-                                    std::bind(
+            m_connection->asyncRead(std::bind(
                                         &SessionData::handleRead,
                                         shared_from_this(),
                                         std::placeholders::_1,
@@ -109,41 +119,40 @@ public:
      * @brief Handle Telnet Options in incoming data
      * raw data is read in from socket
      * m_parsed_data is filled with parsed out options.
+     *
+     * Input Pipeline: Telnet Options are parsed out, then CR\LF is folded
+     * and CP437 is translated to UTF-8 in a single pass. Both buffers are
+     * reused between reads. Glyphs are split off later by the StateManager.
+     * @param buffer
+     * @param length
      */
-    void handleTeloptCodes()
+    void handleTeloptCodes(const unsigned char *buffer, int length)
     {
-        unsigned char ch = 0;
-        std::string incoming_data = "";
+        m_telnet_data.clear();
+        m_parsed_data.clear();
 
-        for(auto c : m_in_data_vector)
+        try
         {
-            try
-            {
-                // Enter the Telnet_State and handle parsing options.
-                ch = m_telnet_state->telnetOptionParse(c);
-            }
-            catch(std::exception& e)
-            {
-                Logging *log = Logging::instance();
-                log->xrmLog<Logging::ERROR_LOG>("Exception telnet_process_char", e.what(), __LINE__, __FILE__);
-            }
-
-            // Skip any incoming nulls, nulls are also return on Telnet options received
-            // So we know that there is no valid text data to send to the client.
-            if(ch == '\0')
-            {
-                continue;
-            }
-
-            // Incoming Buffer is filled and Telnet options are parsed out.
-            incoming_data += ch;
+            // Text is copied in bulk, Telnet options are parsed out.
+            m_telnet_state->decodeInput(buffer, length, m_telnet_data);
+        }
+        catch(std::exception& e)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("Exception decodeInput", e.what(), __LINE__, __FILE__);
         }
 
         // Encode all incoming data as UTF8 unless we are not utf8
-        if(m_encoding != Encoding::ENCODE_UTF8)
-            m_parsed_data = Encoding::instance()->utf8Encode(incoming_data);
-        else
-            m_parsed_data = incoming_data;
+        m_input_normalizer.normalize(m_telnet_data, m_parsed_data, m_encoding != Encoding::ENCODE_UTF8);
+    }
+
+    /**
+     * @brief Callback for when Telnet Option Negotiation has completed, once only.
+     * @param handler
+     */
+    void setNegotiationHandler(std::function<void()> handler)
+    {
+        m_negotiation_handler = handler;
     }
 
     /**
@@ -155,9 +164,9 @@ public:
      * @brief Callback after data received. handles telnet options
      * Then parses out normal text data from client to server.
      * @param error
-     * @param bytes_transferred
+     * @param socket_handler
      */
-    void handleRead(const std::error_code& error, socket_handler_ptr);
+    void handleRead(const std::error_code& error, socket_handler_ptr socket_handler);
 
     /**
      * @brief delivers text data to client
@@ -249,10 +258,41 @@ public:
         // Add Deadline Timer for .400 milliseconds for complete ESC Sequences.
         // Is no other input or part of ESC Sequecnes ie.. [A following the ESC
         // Then it's an ESC key, otherwise capture the rest of the sequence.
+        // Scheduled on the IOService timer wheel, re-arming replaces the last one.
+        session_data_wptr weak_session_data = shared_from_this();
+
         m_esc_input_timer->setWaitInMilliseconds(400);
-        m_esc_input_timer->asyncWait(
-            std::bind(&SessionData::handleEscTimer, shared_from_this())
-        );
+        m_esc_input_timer->asyncWait([weak_session_data](int)
+        {
+            session_data_ptr session_data = weak_session_data.lock();
+
+            if(session_data)
+            {
+                session_data->handleEscTimer();
+            }
+        });
+    }
+
+    /**
+     * @brief Start the Idle Timer, it re-arms itself on the IOService loop
+     *        until the session leaves.  Checks Idle and Logon Timeouts and
+     *        sends Keepalives to find connections that are gone.
+     */
+    void startIdleTimer()
+    {
+        // Weak, so a pending check doesn't hold a session that has left.
+        session_data_wptr weak_session_data = shared_from_this();
+
+        m_idle_timer->setWaitInMilliseconds(IDLE_CHECK_MILLISECONDS);
+        m_idle_timer->asyncWait([weak_session_data](int)
+        {
+            session_data_ptr session_data = weak_session_data.lock();
+
+            if(session_data)
+            {
+                session_data->handleIdleTimer();
+            }
+        });
     }
 
     /**
@@ -349,12 +389,37 @@ private:
      */
     void handleEscTimer();
 
+    /**
+     * @brief Idle Timer, warns then disconnects Idle users, Probes quiet connections.
+     */
+    void handleIdleTimer();
+
+    /**
+     * @brief Callback after the Timeout Message is written, then disconnect.
+     * @param error
+     */
+    void handleIdleDisconnect(const std::error_code& error, socket_handler_ptr);
+
+    /**
+     * @brief Global Prompt translated to ANSI, or the default when it's missing.
+     * @param lookup
+     * @param default_prompt
+     * @return
+     */
+    std::string getGlobalPromptText(const std::string &lookup, const std::string &default_prompt);
+
 public:
 
+    // How often Idle Timeouts and Keepalives are checked.
+    static const int IDLE_CHECK_MILLISECONDS = 15000;
+
+
     connection_ptr        m_connection;
     session_manager_wptr  m_session_manager;
+    session_arena_ptr     m_session_arena;
     telnet_ptr            m_telnet_state;
     deadline_timer_ptr    m_esc_input_timer;
+    deadline_timer_ptr    m_idle_timer;
     state_manager_ptr     m_state_manager;
     IOService            &m_io_service;
 
@@ -370,20 +435,36 @@ public:
     int                   m_node_number;
     bool                  m_is_use_ansi;
     std::string           m_encoding_text;
-    int                   m_encoding;
+
+    // Set on the session's own IOService loop, read by broadcasts from any thread.
+    std::atomic<int>      m_encoding;
+
     bool                  m_is_session_authorized;
     bool                  m_is_leaving;
     bool                  m_is_esc_timer;
     bool                  m_is_process_running;
 
     enum { max_length = 16384 };
-    //char m_raw_data[max_length];  // Raw Incoming
-    std::vector<unsigned char> m_in_data_vector;
     std::string m_parsed_data;      // Telnet Opts parsed out
 
     // Handle to Processes.
     std::vector<process_ptr> m_processes;
 
+    // Terminal Detection waiting on Telnet Option replies.
+    std::function<void()> m_negotiation_handler;
+
+    // Holds ESC Sequences split between packets.
+    InputSequencer        m_input_sequencer;
+
+    // Input Pipeline, Telnet Options parsed out before normalizing.
+    InputNormalizer       m_input_normalizer;
+    std::string           m_telnet_data;
+
+    // Input from the user (not just Telnet Options) resets the Idle Timeouts.
+    std::chrono::steady_clock::time_point m_last_input_time;
+    std::chrono::steady_clock::time_point m_last_keepalive_time;
+    bool                  m_is_idle_warned;
+
 };
 
 #endif // SESSION_DATA_HPP
@@ -2,16 +2,18 @@
 #include "session_data.hpp"
 #include "common_io.hpp"
 #include "encoding.hpp"
+#include "mci_template.hpp"
+#include "regex_validator.hpp"
 #include "logging.hpp"
 
 #include "model-sys/config.hpp"
 #include "utf-cpp/utf8.h"
 
-#include <clocale>
 #include <regex>
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <map>
 
 
 SessionIO::SessionIO()
@@ -620,14 +622,18 @@ std::string SessionIO::parseFilename(const std::string &pipe_code)
     // Strip %%DF and grab the 'Filename.ext
     CommonIO common_io;
     std::string str = pipe_code.substr(4);
-    std::string buffer = common_io.readinAnsi(str);
+    screen_buffer_ptr buffer = common_io.readinAnsiShared(str);
 
-    if(buffer.size() > 0)
+    if(buffer && buffer->size() > 0)
     {
-        return pipe2ansi(buffer);
+        // The file is parsed on it's own, keep this screen's MCI Mappings for the codes after it.
+        std::map<std::string, std::string> mapped_codes(m_mapped_codes);
+        std::string output = pipe2ansi(*buffer);
+        m_mapped_codes.swap(mapped_codes);
+        return output;
     }
 
-    return buffer;
+    return "";
 }
 
 
@@ -690,149 +696,160 @@ std::string SessionIO::parsePipeWithChars(const std::string &pipe_code)
 
 
 /**
- * @brief Parses Code Map and replaces screen codes with ANSI Sequences.
- * @param screen
- * @param code_map
- * @return
+ * @brief Appends the replacement for a Screen Code, or the Code as is when there isn't one.
+ * @param my_matches
+ * @param output
  */
-std::string SessionIO::parseCodeMap(const std::string &screen, std::vector<MapType> &code_map)
+void SessionIO::appendCodeReplacement(const MapType &my_matches, std::string &output)
 {
     Logging *log = Logging::instance();
-    log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMap]", __LINE__, __FILE__);
 
-    std::string ansi_string = screen;
-    MapType my_matches;
-
-    // All Global MCI Codes likes standard screens and colors will
-    // He handled here, then specific interfaces will break out below this.
-    // Break out parsing on which pattern was matched.
-    while(code_map.size() > 0)
+    // Check for Custom Screen Translation Mappings
+    // If these exist, they take presidence over standard codes
+    if(m_mapped_codes.size() > 0)
     {
-        // Loop Backwards to perserve string offsets on replacement.
-        my_matches = code_map.back();
-        code_map.pop_back();
+        std::map<std::string, std::string>::iterator it;
+        it = m_mapped_codes.find(my_matches.m_code);
 
-        // Check for Custom Screen Translation Mappings
-        // If these exist, they take presidence over standard codes
-        if(m_mapped_codes.size() > 0)
+        if(it != m_mapped_codes.end())
         {
-            std::map<std::string, std::string>::iterator it;
-            it = m_mapped_codes.find(my_matches.m_code);
-
-            if(it != m_mapped_codes.end())
-            {
-                // If found, replace mci sequence with text
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, it->second);
-                continue;
-            }
+            // If found, replace mci sequence with text
+            output += it->second;
+            return;
         }
+    }
 
-        // Handle parsing on expression match.
-        switch(my_matches.m_match)
+    // Handle parsing on expression match.
+    switch(my_matches.m_match)
+    {
+        case 1: // Pipe w/ 2 DIDIT Colors
         {
-            case 1: // Pipe w/ 2 DIDIT Colors
-            {
-                log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 DIDIT Colors |00");
-                std::string result = pipeColors(my_matches.m_code);
+            log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 DIDIT Colors |00");
+            std::string result = pipeColors(my_matches.m_code);
 
-                if(result.size() != 0)
-                {
-                    // Replace the Color, if not ansi then remove the color!
-                    if(m_session_data->m_is_use_ansi)
-                    {
-                        ansi_string.replace(my_matches.m_offset, my_matches.m_length, result);
-                    }
-                    else
-                    {
-                        ansi_string.replace(my_matches.m_offset, my_matches.m_length, "");
-                    }
-                }
-                else
+            if(result.size() != 0)
+            {
+                // Replace the Color, if not ansi then remove the color!
+                if(m_session_data->m_is_use_ansi)
                 {
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, "   ");
+                    output += result;
                 }
             }
-            break;
-
-            case 2: // Pipe w/ 2 Chars and 4 Digits // |XY0101
+            else
             {
-                log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 Chars and 4 Digits // |XY0101");
-                // Remove for now, haven't gotten this far!
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, "       ");
+                output += "   ";
             }
-            break;
+        }
+        break;
 
-            case 3: // Pipe w/ 1 or 2 CHARS followed by 1 or 2 DIGITS
-            {
-                log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 1 or 2 CHARS followed by 1 or 2 DIGITS // |A1 A22  AA2  AA33");
-                std::string result = seperatePipeWithCharsDigits(my_matches.m_code);
+        case 2: // Pipe w/ 2 Chars and 4 Digits // |XY0101
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 Chars and 4 Digits // |XY0101");
+            // Remove for now, haven't gotten this far!
+            output += "       ";
+        }
+        break;
 
-                if(result.size() != 0)
-                {
-                    // Replace the string
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, result);
-                }
-            }
-            break;
+        case 3: // Pipe w/ 1 or 2 CHARS followed by 1 or 2 DIGITS
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 1 or 2 CHARS followed by 1 or 2 DIGITS // |A1 A22  AA2  AA33");
+            std::string result = seperatePipeWithCharsDigits(my_matches.m_code);
 
-            case 4: // Pipe w/ 2 CHARS
-                // This one will need replacement in the string parsing
-                // Pass the original string becasue of |DE for delay!
+            if(result.size() != 0)
             {
-                log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 CHARS // |AA");
-                std::string result = parsePipeWithChars(my_matches.m_code);
-
-                if(result.size() != 0)
-                {
-                    // Replace the string
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, result);
-                }
-                else
-                {
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, "   ");
-                }
+                output += result;
             }
-            break;
-
-            case 5: // %%FILENAME.EXT  get filenames for loading from string prompts
+            else
             {
-                log->xrmLog<Logging::DEBUG_LOG>("Replacing %%FILENAME.EXT codes");
-                std::string result = parseFilename(my_matches.m_code);
-
-                if(result.size() != 0)
-                {
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, result);
-                }
-                else
-                {
-                    std::string s(my_matches.m_length, ' ');
-                    ansi_string.replace(my_matches.m_offset, my_matches.m_length, s);
-                }
+                output += my_matches.m_code;
             }
-            break;
+        }
+        break;
+
+        case 4: // Pipe w/ 2 CHARS
+            // This one will need replacement in the string parsing
+            // Pass the original string becasue of |DE for delay!
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("Pipe w/ 2 CHARS // |AA");
+            std::string result = parsePipeWithChars(my_matches.m_code);
 
-            case 6: // Percent w/ 2 CHARS
+            if(result.size() != 0)
             {
-                log->xrmLog<Logging::DEBUG_LOG>("Percent w/ 2 CHARS");
-                // Remove for now, haven't gotten this far!
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, "   ");
+                output += result;
             }
-            break;
+            else
+            {
+                output += "   ";
+            }
+        }
+        break;
 
-            case 7: // Percent with 2 digits, custom codes
+        case 5: // %%FILENAME.EXT  get filenames for loading from string prompts
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("Replacing %%FILENAME.EXT codes");
+            std::string result = parseFilename(my_matches.m_code);
+
+            if(result.size() != 0)
             {
-                // Were just removing them becasue they are processed.
-                // Now that first part of sequence |01 etc.. are processed!
-                log->xrmLog<Logging::DEBUG_LOG>("replacing %## codes");
-                // Remove for now, haven't gotten this far!
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, "   ");
+                output += result;
             }
-            break;
+            else
+            {
+                output.append(my_matches.m_length, ' ');
+            }
+        }
+        break;
 
-            default:
-                break;
+        case 6: // Percent w/ 2 CHARS
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("Percent w/ 2 CHARS");
+            // Remove for now, haven't gotten this far!
+            output += "   ";
         }
+        break;
+
+        case 7: // Percent with 2 digits, custom codes
+        {
+            // Were just removing them becasue they are processed.
+            // Now that first part of sequence |01 etc.. are processed!
+            log->xrmLog<Logging::DEBUG_LOG>("replacing %## codes");
+            // Remove for now, haven't gotten this far!
+            output += "   ";
+        }
+        break;
+
+        default:
+            output += my_matches.m_code;
+            break;
     }
+}
+
+/**
+ * @brief Parses Code Map and replaces screen codes with ANSI Sequences.
+ *        Built in a single pass, text between codes is copied as is.
+ * @param screen
+ * @param code_map - In order of offset, as parsed from the screen.
+ * @return
+ */
+std::string SessionIO::parseCodeMap(const std::string &screen, std::vector<MapType> &code_map)
+{
+    Logging *log = Logging::instance();
+    log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMap]", __LINE__, __FILE__);
+
+    std::string ansi_string;
+    ansi_string.reserve(screen.size());
+    std::string::size_type position = 0;
+
+    // All Global MCI Codes likes standard screens and colors will
+    // He handled here, then specific interfaces will break out below this.
+    for(auto &my_matches : code_map)
+    {
+        ansi_string.append(screen, position, my_matches.m_offset - position);
+        appendCodeReplacement(my_matches, ansi_string);
+        position = my_matches.m_offset + my_matches.m_length;
+    }
+
+    ansi_string.append(screen, position, std::string::npos);
 
     // Clear Codemap.
     std::vector<MapType>().swap(code_map);
@@ -844,8 +861,9 @@ std::string SessionIO::parseCodeMap(const std::string &screen, std::vector<MapTy
 
 /**
  * @brief Parses Code Map and replaces screen codes with Generic Items.
+ *        Built in a single pass, text between codes is copied as is.
  * @param screen
- * @param code_map
+ * @param code_map - In order of offset, as parsed from the screen.
  * @return
  */
 std::string SessionIO::parseCodeMapGenerics(const std::string &screen, const std::vector<MapType> &code_map)
@@ -853,65 +871,79 @@ std::string SessionIO::parseCodeMapGenerics(const std::string &screen, const std
     Logging *log = Logging::instance();
     log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMapGenerics]", __LINE__, __FILE__);
 
-    std::string ansi_string = screen;
-    MapType my_matches;
-
-    // Make a copy so the original is not modified.
-    std::vector<MapType> code_mapping;
-    code_mapping.assign(code_map.begin(), code_map.end());
+    std::string ansi_string;
+    ansi_string.reserve(screen.size());
+    std::string::size_type position = 0;
 
-    // All Global MCI Codes likes standard screens and colors will
-    // He handled here, then specific interfaces will break out below this.
-    // Break out parsing on which pattern was matched.
-    while(code_mapping.size() > 0)
+    for(auto &my_matches : code_map)
     {
-        // Loop Backwards to perserve string offsets on replacement.
-        my_matches = code_mapping.back();
-        code_mapping.pop_back();
+        ansi_string.append(screen, position, my_matches.m_offset - position);
+        position = my_matches.m_offset + my_matches.m_length;
 
-        // Check for Custom Screen Translation Mappings
-        // If these exist, they take presidence over standard codes
-        if(m_mapped_codes.size() > 0)
+        // Codes are left as is when there are no Custom Screen Translation Mappings
+        if(m_mapped_codes.size() == 0)
         {
-            std::map<std::string, std::string>::iterator it;
-            it = m_mapped_codes.find(my_matches.m_code);
+            ansi_string += my_matches.m_code;
+            continue;
+        }
 
-            if(it != m_mapped_codes.end())
-            {
-                log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMapGenerics] gen found=", my_matches.m_code, it->second, __LINE__, __FILE__);
-                // If found, replace mci sequence with text
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, it->second);
-            }
-            else
-            {
-                log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMapGenerics] gen not found=", __LINE__, __FILE__);
-                std::string remove_code = "";
-                ansi_string.replace(my_matches.m_offset, my_matches.m_length, remove_code);
-            }
+        std::map<std::string, std::string>::iterator it;
+        it = m_mapped_codes.find(my_matches.m_code);
+
+        if(it != m_mapped_codes.end())
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMapGenerics] gen found=", my_matches.m_code, it->second, __LINE__, __FILE__);
+            // If found, replace mci sequence with text
+            ansi_string += it->second;
+        }
+        else
+        {
+            log->xrmLog<Logging::DEBUG_LOG>("[parseCodeMapGenerics] gen not found=", __LINE__, __FILE__);
         }
     }
 
+    ansi_string.append(screen, position, std::string::npos);
+
     // Clear MCI And Code Mappings
     clearAllMCIMapping();
-    std::vector<MapType>().swap(code_mapping);
     return ansi_string;
 }
 
+/**
+ * @brief Template Syntax for SessionIO's Expressions, -1 for any other expression.
+ * @param expression
+ * @return
+ */
+int SessionIO::getTemplateSyntax(const std::string &expression) const
+{
+    if(expression == STD_EXPRESSION)
+    {
+        return MciTemplate::MCI_STANDARD;
+    }
+    else if(expression == MID_EXPRESSION)
+    {
+        return MciTemplate::MCI_GENERIC;
+    }
+    else if(expression == PROMPT_EXPRESSION)
+    {
+        return MciTemplate::MCI_PROMPT;
+    }
+    else if(expression == FORMAT_EXPRESSION)
+    {
+        return MciTemplate::MCI_FORMAT;
+    }
+
+    return -1;
+}
+
 /**
  * @brief Parses string and returns code mapping and positions per expression
+ *        MCI Expressions use precompiled templates, others a cached std::regex.
  * @param sequence
  * @return
  */
 std::vector<MapType> SessionIO::parseToCodeMap(const std::string &sequence, const std::string &expression)
 {
-    // Contains all matches found so we can iterate and reaplace
-    // Without Multiple loops through the string.
-    MapType my_matches;
-    std::vector<MapType> code_map;
-
-    // Make a copy that we can modify and process on.
-    std::string ansi_string = sequence;
-
     // MCI Code Groups 1 - 7
     /*
         ([|]{1}[0-9]{2})                // |00
@@ -922,27 +954,42 @@ std::vector<MapType> SessionIO::parseToCodeMap(const std::string &sequence, cons
         ([%]{1}[A-Z]{2})                // %AA
         ([%]{1}[0-9]{2})                // %11
     */
+    int syntax = getTemplateSyntax(expression);
+
+    if(syntax >= 0)
+    {
+        return MciTemplate::getTemplate(syntax, sequence)->getCodeMap();
+    }
+
+    // Contains all matches found so we can iterate and reaplace
+    // Without Multiple loops through the string.
+    MapType my_matches;
+    my_matches.m_or = false;
+    std::vector<MapType> code_map;
+
+    // Expressions are compiled once, const regex searches are safe between threads.
+    std::string error = "";
+    regex_ptr expr = RegexValidator::getExpression(expression, error);
+
+    if(!expr)
+    {
+        if(!error.empty())
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("[parseToCodeMap] Expression=", expression, "Exception=", error, __LINE__, __FILE__);
+        }
+
+        return code_map;
+    }
 
-    //std::cout << "exp: " << expression << std::endl;
     try
     {
-        std::regex expr(expression);
         std::smatch matches;
-        std::string::const_iterator start = ansi_string.begin(), end = ansi_string.end();
-        //    std::string::size_type offset = 0;
-        //    std::string::size_type length = 0;
-
+        std::string::const_iterator start = sequence.begin(), end = sequence.end();
         std::regex_constants::match_flag_type flags = std::regex_constants::match_default;
 
-        while(std::regex_search(start, end, matches, expr, flags))
+        while(std::regex_search(start, end, matches, *expr, flags))
         {
-            // Found a match!
-            /*
-            std::cout << "Matched Sub '" << matches.str()
-            		  << "' following ' " << matches.prefix().str()
-            		  << "' preceeding ' " << matches.suffix().str()
-            		  << std::endl;*/
-
             // Avoid Infinite loop and make sure the existing
             // is not the same as the next!
             if(start == matches[0].second)
@@ -952,8 +999,6 @@ std::vector<MapType> SessionIO::parseToCodeMap(const std::string &sequence, cons
                 break;
             }
 
-            // Since were replacing on the fly, we need to rescan the
-            // string for next code
             start = matches[0].second;
 
             // Loop each match, and grab the starting position and length to replace.
@@ -962,33 +1007,12 @@ std::vector<MapType> SessionIO::parseToCodeMap(const std::string &sequence, cons
                 // Make sure the Match is true! otherwise skip.
                 if(matches[s].matched)
                 {
-                    //offset = matches[s].first - ansi_string.begin();
-                    //length = matches[s].length();
-
-                    // Test output s registers which pattern matched, 1, 2, or 3!
-                    /*
-                    std::cout << s << " :  Matched Sub 2" << matches[s].str()
-                    		  << " at offset " << offset
-                    		  << " of length " << length
-                    		  << std::endl;*/
-
                     // Add to Vector so we store each match.
-                    my_matches.m_offset = matches[s].first - ansi_string.begin();
+                    my_matches.m_offset = matches[s].first - sequence.begin();
                     my_matches.m_length = matches[s].length();
                     my_matches.m_match  = s;
                     my_matches.m_code   = matches[s].str();
 
-                    // TODO, check, might not be needed here, might be pre-parsing!!
-                    // UTF-8. meed to use a utf8-distance to get actual char off-set to match
-                    // screen buffer now vs. raw byte off-set.
-                    /*
-                    int match_off_set = my_matches.m_offset;
-                    auto new_it = ansi_string.begin() + match_off_set;
-                    int char_length = utf8::distance(ansi_string.begin(), new_it);
-
-                    my_matches.m_offset = char_length;
-                    */
-
                     code_map.push_back(std::move(my_matches));
                 }
             }
@@ -1005,13 +1029,23 @@ std::vector<MapType> SessionIO::parseToCodeMap(const std::string &sequence, cons
 
 /**
  * @brief Converts MCI Sequences to Ansi screen output.
+ *        The compiled template is reused, codes are filled in with a single pass.
  * @param sequence
  * @return
  */
 std::string SessionIO::pipe2ansi(const std::string &sequence)
 {
-    std::vector<MapType> code_map = parseToCodeMap(sequence, STD_EXPRESSION);
-    return parseCodeMap(sequence, code_map);
+    mci_template_ptr mci_template = MciTemplate::getTemplate(MciTemplate::MCI_STANDARD, sequence);
+
+    std::string ansi_string;
+    mci_template->render(sequence, ansi_string, [this](const MapType &code, std::string &output)
+    {
+        appendCodeReplacement(code, output);
+    });
+
+    // Clear Custom MCI Screen Translation Mappings
+    clearAllMCIMapping();
+    return ansi_string;
 }
 
 /**
@@ -1021,8 +1055,7 @@ std::string SessionIO::pipe2ansi(const std::string &sequence)
  */
 std::vector<MapType> SessionIO::pipe2genericCodeMap(const std::string &sequence)
 {
-    std::vector<MapType> code_map = parseToCodeMap(sequence, MID_EXPRESSION);
-    return code_map;
+    return MciTemplate::getTemplate(MciTemplate::MCI_GENERIC, sequence)->getCodeMap();
 }
 
 /**
@@ -1032,9 +1065,7 @@ std::vector<MapType> SessionIO::pipe2genericCodeMap(const std::string &sequence)
  */
 std::vector<MapType> SessionIO::pipe2promptCodeMap(const std::string &sequence)
 {
-    // This will handle parsing the sequence, and replacement
-    std::vector<MapType> code_map = parseToCodeMap(sequence, PROMPT_EXPRESSION);
-    return code_map;
+    return MciTemplate::getTemplate(MciTemplate::MCI_PROMPT, sequence)->getCodeMap();
 }
 
 /**
@@ -1044,9 +1075,7 @@ std::vector<MapType> SessionIO::pipe2promptCodeMap(const std::string &sequence)
  */
 std::vector<MapType> SessionIO::pipe2promptFormatCodeMap(const std::string &sequence)
 {
-    // This will handle parsing the sequence, and replacement
-    std::vector<MapType> code_map = parseToCodeMap(sequence, FORMAT_EXPRESSION);
-    return code_map;
+    return MciTemplate::getTemplate(MciTemplate::MCI_FORMAT, sequence)->getCodeMap();
 }
 
 /**
@@ -1130,23 +1159,14 @@ std::string SessionIO::pipe2promptFormat(const std::string &sequence, config_ptr
  */
 bool SessionIO::checkRegex(const std::string &sequence, const std::string &expression)
 {
-    // Create system default locale
-    std::setlocale(LC_ALL, Encoding::ENCODING_TEXT_UTF8.c_str());
-    std::cout.imbue(std::locale());
+    // Compiled once and shared, no locale changes while sessions are running.
+    std::string error = "";
+    bool result = RegexValidator::match(sequence, expression, error);
 
-    std::smatch match;
-    bool result = false;
-
-    //std::cout << "exp: " << expression << std::endl;
-    try
-    {
-        std::regex regExpression(expression);
-        result = std::regex_match(sequence, match, regExpression);
-    }
-    catch(std::regex_error &ex)
+    if(!error.empty())
     {
         Logging *log = Logging::instance();
-        log->xrmLog<Logging::ERROR_LOG>("[checkRegex] Expression=", expression, "Exception=", ex.what(), ex.code(), __LINE__, __FILE__);
+        log->xrmLog<Logging::ERROR_LOG>("[checkRegex] Expression=", expression, "Exception=", error, __LINE__, __FILE__);
     }
 
     return result;
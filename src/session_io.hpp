@@ -165,6 +165,20 @@ public:
      */
     std::string parseCodeMapGenerics(const std::string &screen, const std::vector<MapType> &code_map);
 
+    /**
+     * @brief Appends the replacement for a Screen Code, or the Code as is when there isn't one.
+     * @param my_matches
+     * @param output
+     */
+    void appendCodeReplacement(const MapType &my_matches, std::string &output);
+
+    /**
+     * @brief Template Syntax for SessionIO's Expressions, -1 for any other expression.
+     * @param expression
+     * @return
+     */
+    int getTemplateSyntax(const std::string &expression) const;
+
     /**
      * @brief Parses string and returns code mapping and positions
      * @param sequence
@@ -1,9 +1,11 @@
 #include "session_manager.hpp"
 #include "session.hpp"
 #include "logging.hpp"
+#include "encoding.hpp"
 
 #include <functional>
 #include <algorithm>
+#include <atomic>
 
 
 SessionManager::~SessionManager()
@@ -16,7 +18,32 @@ SessionManager::~SessionManager()
  */
 void SessionManager::join(session_ptr session)
 {
-    m_sessions.insert(session);
+    int node_number = session->m_session_data->m_node_number;
+
+    if(node_number < 1)
+    {
+        return;
+    }
+
+    bool is_new_node = false;
+    session_list_ptr old_snapshot;
+
+    publishSnapshot([&](session_list &sessions)
+    {
+        if(sessions.size() < (session_list::size_type)node_number)
+        {
+            sessions.resize(node_number);
+        }
+
+        is_new_node = !sessions[node_number - 1];
+        sessions[node_number - 1] = session;
+        return true;
+    }, old_snapshot);
+
+    if(is_new_node)
+    {
+        ++m_connections;
+    }
 }
 
 /**
@@ -28,19 +55,42 @@ void SessionManager::leave(int node_number)
     Logging *log = Logging::instance();
     log->xrmLog<Logging::CONSOLE_LOG>("disconnecting Node Session=", node_number);
 
-    for(auto it = m_sessions.begin(); it != m_sessions.end(); it++)
+    // The old snapshot keeps the session alive until the lock is released, the
+    // Session Destructor cleans up the node and can't run while holding the lock.
+    session_list_ptr old_snapshot;
+
+    bool is_removed = publishSnapshot([&](session_list &sessions)
     {
-        if((*it)->m_session_data->m_node_number == node_number)
+        if(node_number < 1 || sessions.size() < (session_list::size_type)node_number ||
+                !sessions[node_number - 1])
         {
-            m_sessions.erase(it);
-            log->xrmLog<Logging::CONSOLE_LOG>("disconnecting Node Session completed=", node_number);
-            break;
+            return false;
         }
+
+        sessions[node_number - 1].reset();
+
+        // Trim free nodes from the end, so snapshots only cover the highest node.
+        while(!sessions.empty() && !sessions.back())
+        {
+            sessions.pop_back();
+        }
+
+        return true;
+    }, old_snapshot);
+
+    if(!is_removed)
+    {
+        return;
     }
+
+    --m_connections;
+    log->xrmLog<Logging::CONSOLE_LOG>("disconnecting Node Session completed=", node_number);
 }
 
 /**
  * @brief Sends message to all users in the current room.
+ *        Rendered once for each output encoding, and the buffers
+ *        are shared by every session's output queue.
  * @param participant
  */
 void SessionManager::deliver(std::string msg)
@@ -50,8 +100,39 @@ void SessionManager::deliver(std::string msg)
 
     Logging *log = Logging::instance();
     log->xrmLog<Logging::DEBUG_LOG>("deliver SessionManager notices=", msg);
-    std::for_each(m_sessions.begin(), m_sessions.end(),
-                  std::bind(&Session::deliver, std::placeholders::_1, std::ref(msg)));
+
+    session_list_ptr sessions = getSessions();
+    output_buffer_ptr utf8_buffer;
+    output_buffer_ptr cp437_buffer;
+
+    for(auto &session : *sessions)
+    {
+        if(!session)
+        {
+            continue;
+        }
+
+        // On Output, We have internal UTF8 now, translate to CP437
+        // Encoding is atomic, it can change on the session's own loop while we read it.
+        if(session->m_session_data->m_encoding.load() == Encoding::ENCODE_CP437)
+        {
+            if(!cp437_buffer)
+            {
+                cp437_buffer = std::make_shared<const std::string>(Encoding::instance()->utf8Decode(msg));
+            }
+
+            session->deliverBuffer(cp437_buffer);
+        }
+        else
+        {
+            if(!utf8_buffer)
+            {
+                utf8_buffer = std::make_shared<const std::string>(msg);
+            }
+
+            session->deliverBuffer(utf8_buffer);
+        }
+    }
 }
 
 /**
@@ -61,25 +142,91 @@ void SessionManager::deliver(std::string msg)
  */
 int SessionManager::connections()
 {
-    int count = 0;
+    return m_connections;
+}
 
-    for(auto it = begin(m_sessions); it != end(m_sessions); ++it)
+/**
+ * @brief Broacaster Anchors the Sessions, we loop to shutdown all connections.
+ * @return
+ */
+void SessionManager::shutdown()
+{
+    // Sessions are released after the lock, shutdowns can call leave().
+    session_list_ptr old_snapshot;
+
+    publishSnapshot([](session_list &sessions)
+    {
+        sessions.clear();
+        return true;
+    }, old_snapshot);
+
+    m_connections = 0;
+
+    for(auto &session : *old_snapshot)
+    {
+        if(session)
+        {
+            session->m_connection->shutdown();
+        }
+    }
+}
+
+/**
+ * @brief Lookup the Session on a Node, Null when the Node is free.
+ * @param node_number
+ * @return
+ */
+session_ptr SessionManager::getSession(int node_number)
+{
+    session_list_ptr sessions = getSessions();
+
+    if(node_number < 1 || sessions->size() < (session_list::size_type)node_number)
     {
-        ++count;
+        return nullptr;
     }
 
-    return count;
+    return (*sessions)[node_number - 1];
 }
 
 /**
- * @brief Broacaster Anchors the Sessions, we loop to shutdown all connections.
+ * @brief Read Only Snapshot of Sessions indexed by Node Number - 1,
+ *        Slots for free nodes are Null.  Doesn't take the lock.
  * @return
  */
-void SessionManager::shutdown()
+session_list_ptr SessionManager::getSessions()
+{
+    return std::atomic_load(&m_snapshot);
+}
+
+/**
+ * @brief Copy the current snapshot and apply the change outside the lock, the lock is
+ *        only held to swap in the new one.  If another join or leave swapped first
+ *        the change is made again on the newer snapshot.
+ * @param update - Changes the copy, return false to leave the snapshot as is.
+ * @param old_snapshot - Replaced snapshot, to be released after the lock.
+ * @return false if the update made no change.
+ */
+bool SessionManager::publishSnapshot(const std::function<bool(session_list &)> &update,
+                                     session_list_ptr &old_snapshot)
 {
-    for(auto it = begin(m_sessions); it != end(m_sessions); ++it)
+    while(true)
     {
-        (*it)->m_connection->shutdown();
-        m_sessions.erase(it);
+        session_list_ptr current = getSessions();
+        std::shared_ptr<session_list> snapshot = std::make_shared<session_list>(*current);
+
+        if(!update(*snapshot))
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_session_mutex);
+
+        if(m_snapshot != current)
+        {
+            continue;
+        }
+
+        old_snapshot = std::atomic_exchange(&m_snapshot, session_list_ptr(snapshot));
+        return true;
     }
 }
@@ -4,11 +4,17 @@
 #include <memory>
 #include <iostream>
 #include <string>
-#include <set>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
 
 class Session;
 typedef std::shared_ptr<Session> session_ptr;
 
+typedef std::vector<session_ptr>            session_list;
+typedef std::shared_ptr<const session_list> session_list_ptr;
+
 /**
  * @class SessionManager
  * @author Michael Griffin
@@ -16,11 +22,16 @@ typedef std::shared_ptr<Session> session_ptr;
  * @file session_manager.hpp
  * @brief Main Channel of Communications between Sessions
  * Also Very Import, keeps handle on Active Sessions and keeps smart pointers alive!
+ * Sessions are indexed by Node Number, join and leave build a new read only
+ * snapshot and swap it in, broadcasts and lookups read without taking the lock.
  */
 class SessionManager
 {
 public:
     explicit SessionManager()
+        : m_session_mutex()
+        , m_snapshot(std::make_shared<session_list>())
+        , m_connections(0)
     {
     }
     ~SessionManager();
@@ -37,9 +48,19 @@ public:
     int connections();
     void shutdown();
 
+    session_ptr getSession(int node_number);
+    session_list_ptr getSessions();
+
 private:
 
-    std::set<session_ptr> m_sessions;
+    bool publishSnapshot(const std::function<bool(session_list &)> &update, session_list_ptr &old_snapshot);
+
+    // Sessions join and leave from each IOService loop thread, held only to swap snapshots.
+    std::mutex            m_session_mutex;
+
+    // Index is Node Number - 1, empty slots for free nodes.
+    session_list_ptr      m_snapshot;
+    std::atomic<int>      m_connections;
 };
 
 typedef std::shared_ptr<SessionManager> session_manager_ptr;
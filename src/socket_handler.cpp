@@ -17,6 +17,114 @@ int SocketHandler::sendSocket(unsigned char *buffer, Uint32 length)
     return m_socket.back()->sendSocket(buffer, length);
 }
 
+/**
+ * @brief Queue data to be sent on the next flush, the buffer is referenced not copied.
+ * @param data
+ */
+void SocketHandler::queueOutput(output_buffer_ptr data)
+{
+    if(!data || data->empty())
+    {
+        return;
+    }
+
+    if(m_compressor)
+    {
+        // Each connection has it's own deflate stream, shared output is compressed per connection.
+        // Fragments are joined in the stream, it's sync flushed once on the next flushOutput().
+        if(!m_compressor->compress(*data))
+        {
+            // Stream is corrupt for the client now, there's no recovering it.
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("MCCP2 deflate failed, dropping connection", __FILE__, __LINE__);
+            m_is_active = false;
+        }
+
+        return;
+    }
+
+    m_output_size += data->size();
+    m_output_queue.push_back(std::move(data));
+}
+
+/**
+ * @brief Check if there is data waiting to be sent
+ * @return
+ */
+bool SocketHandler::hasQueuedOutput() const
+{
+    return !m_output_queue.empty() || (m_compressor && m_compressor->isFlushNeeded());
+}
+
+/**
+ * @brief Number of bytes queued and not yet sent
+ * @return
+ */
+unsigned long SocketHandler::getQueuedOutputSize() const
+{
+    return m_output_size;
+}
+
+/**
+ * @brief Send queued data in one call, removes only what was sent.
+ * @return bytes sent, or -1 on errors
+ */
+int SocketHandler::flushOutput()
+{
+    if(m_compressor && m_compressor->isFlushNeeded())
+    {
+        // One sync point per burst, after everything queued since the last send.
+        std::string compressed;
+
+        if(!m_compressor->flush(compressed))
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("MCCP2 deflate flush failed, dropping connection", __FILE__, __LINE__);
+            m_is_active = false;
+            return -1;
+        }
+
+        if(!compressed.empty())
+        {
+            m_output_size += compressed.size();
+            m_output_queue.push_back(std::make_shared<const std::string>(std::move(compressed)));
+        }
+    }
+
+    if(m_output_queue.empty() || m_socket.empty())
+    {
+        return 0;
+    }
+
+    int result = m_socket.back()->sendSocketBuffers(m_output_queue, m_output_offset);
+
+    if(result < 0)
+    {
+        return -1;
+    }
+
+    // Drop fully sent fragments, keep the position in a partial one.
+    unsigned long sent = (unsigned long)result;
+    m_output_size -= (sent < m_output_size) ? sent : m_output_size;
+
+    while(!m_output_queue.empty())
+    {
+        unsigned long remaining = m_output_queue.front()->size() - m_output_offset;
+
+        if(sent < remaining)
+        {
+            m_output_offset += sent;
+            break;
+        }
+
+        sent -= remaining;
+        m_output_offset = 0;
+        m_output_queue.pop_front();
+    }
+
+    return result;
+}
+
 /**
  * @brief Receive Waiting Socket Data
  * @param message
@@ -27,6 +135,46 @@ int SocketHandler::recvSocket(char *message)
     return m_socket.back()->recvSocket(message);
 }
 
+/**
+ * @brief Receive Waiting Socket Data into the connection's reusable buffer
+ * @return
+ */
+int SocketHandler::recvSocketBuffer()
+{
+    // Extra byte, sockets terminate the data received.
+    if(m_read_buffer.size() < (unsigned int)IOService::MAX_BUFFER_SIZE + 1)
+    {
+        m_read_buffer.resize(IOService::MAX_BUFFER_SIZE + 1);
+    }
+
+    int length = recvSocket((char *)&m_read_buffer[0]);
+    m_read_length = (length > 0) ? length : 0;
+    return length;
+}
+
+/**
+ * @brief Data from the last read, valid up to getReadLength()
+ * @return
+ */
+const unsigned char *SocketHandler::getReadBuffer() const
+{
+    if(m_read_buffer.empty())
+    {
+        return nullptr;
+    }
+
+    return &m_read_buffer[0];
+}
+
+/**
+ * @brief Number of bytes from the last read
+ * @return
+ */
+int SocketHandler::getReadLength() const
+{
+    return m_read_length;
+}
+
 /**
  * @brief Poll if Socket has any data to retrieve
  * @return
@@ -67,6 +215,78 @@ int SocketHandler::poll()
     return ret;
 }
 
+/**
+ * @brief Socket Descriptor for registering with the IOService reactor
+ * @return -1 when the socket can't be waited on directly.
+ */
+int SocketHandler::getSocketId()
+{
+    if(m_is_active && m_socket.size() > 0)
+    {
+        return m_socket.back()->getSocketId();
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Remote IP Address of the connection
+ * @return
+ */
+std::string SocketHandler::getPeerAddress()
+{
+    if(m_socket.size() > 0)
+    {
+        return m_socket.back()->getPeerAddress();
+    }
+
+    return "";
+}
+
+/**
+ * @brief Held for the life of the connection, frees it's admission slot on close.
+ * @param ticket
+ */
+void SocketHandler::setAdmissionTicket(admission_ticket_ptr ticket)
+{
+    m_admission_ticket = ticket;
+}
+
+/**
+ * @brief Start MCCP2, called after IAC SB COMPRESS2 IAC SE is queued.
+ * @param level
+ * @param memory_limit_kb
+ * @return
+ */
+bool SocketHandler::startCompression(int level, int memory_limit_kb)
+{
+    if(m_compressor)
+    {
+        return true;
+    }
+
+    stream_compressor_ptr compressor(new StreamCompressor());
+
+    if(!compressor->start(level, memory_limit_kb))
+    {
+        Logging *log = Logging::instance();
+        log->xrmLog<Logging::ERROR_LOG>("MCCP2 unable to start deflate", __FILE__, __LINE__);
+        return false;
+    }
+
+    m_compressor = compressor;
+    return true;
+}
+
+/**
+ * @brief Check if output is being compressed (MCCP2)
+ * @return
+ */
+bool SocketHandler::isCompressing() const
+{
+    return m_compressor != nullptr;
+}
+
 /**
  * @brief Connect Telnet Socket
  * @param host
@@ -210,9 +430,11 @@ bool SocketHandler::connectIrcSocket(std::string host, int port)
  * @brief Telnet Socket Listener
  * @param host
  * @param port
+ * @param is_reuse_port
+ * @param is_posix_socket - Raw POSIX Socket, SDL_Socket otherwise
  * @return
  */
-bool SocketHandler::createTelnetAcceptor(std::string host, int port)
+bool SocketHandler::createTelnetAcceptor(std::string host, int port, bool is_reuse_port, bool is_posix_socket)
 {
     Logging *log = Logging::instance();
 
@@ -221,8 +443,20 @@ bool SocketHandler::createTelnetAcceptor(std::string host, int port)
         try
         {
             m_socket_type = SOCKET_TYPE_TELNET;
-            socket_state_ptr sdl_socket(new SDL_Socket(host, port));
-            m_socket.push_back(sdl_socket);
+#ifndef _WIN32
+            if(is_posix_socket)
+            {
+                std::shared_ptr<POSIX_Socket> posix_socket(new POSIX_Socket(host, port));
+                posix_socket->setReusePort(is_reuse_port);
+                m_socket.push_back(posix_socket);
+            }
+            else
+#endif
+            {
+                std::shared_ptr<SDL_Socket> sdl_socket(new SDL_Socket(host, port));
+                sdl_socket->setReusePort(is_reuse_port);
+                m_socket.push_back(sdl_socket);
+            }
 
             if(m_socket.back()->onListen())
             {
@@ -238,7 +472,7 @@ bool SocketHandler::createTelnetAcceptor(std::string host, int port)
         catch(std::exception& e)
         {
             close();
-            log->xrmLog<Logging::ERROR_LOG>("Exception creating new SDL_Socket", e.what(), __FILE__, __LINE__);
+            log->xrmLog<Logging::ERROR_LOG>("Exception creating new Telnet Socket", e.what(), __FILE__, __LINE__);
             return false;
         }
     }
@@ -303,6 +537,10 @@ void SocketHandler::close()
         m_socket_type.erase();
         m_socket.pop_back();
         std::vector<socket_state_ptr>().swap(m_socket);
+
+        // Socket is gone, free the admission slot now.
+        m_admission_ticket.reset();
+        m_compressor.reset();
     }
     catch(std::exception& e)
     {
@@ -3,9 +3,12 @@
 
 #include "socket_state.hpp"
 #include "io_service.hpp"
+#include "admission_control.hpp"
+#include "stream_compressor.hpp"
 
 #include <iostream>
 #include <vector>
+#include <deque>
 #include <memory>
 
 /**
@@ -23,6 +26,13 @@ public:
         : m_socket()
         , m_socket_type("")
         , m_is_active(false)
+        , m_read_buffer()
+        , m_read_length(0)
+        , m_output_queue()
+        , m_output_offset(0)
+        , m_output_size(0)
+        , m_admission_ticket()
+        , m_compressor()
     {
     }
 
@@ -40,9 +50,31 @@ public:
     int recvSocket(char *message);
     int poll();
 
+    // Output Queue, fragments are held and sent together once per IOService pass.
+    // Whatever the socket doesn't accept stays queued for the next flush.
+    void queueOutput(output_buffer_ptr data);
+    bool hasQueuedOutput() const;
+    unsigned long getQueuedOutputSize() const;
+    int flushOutput();
+
+    // Reads into the reusable connection buffer, only the length read is valid.
+    int recvSocketBuffer();
+    const unsigned char *getReadBuffer() const;
+    int getReadLength() const;
+
+    int getSocketId();
+    std::string getPeerAddress();
+
+    // Held for the life of the connection, frees it's admission slot on close.
+    void setAdmissionTicket(admission_ticket_ptr ticket);
+
+    // MCCP2, all output queued after this is deflated.
+    bool startCompression(int level, int memory_limit_kb);
+    bool isCompressing() const;
+
     // Telnet
     bool connectTelnetSocket(std::string host, int port);
-    bool createTelnetAcceptor(std::string host, int port);
+    bool createTelnetAcceptor(std::string host, int port, bool is_reuse_port = false, bool is_posix_socket = false);
     socket_handler_ptr acceptTelnetConnection();
 
     // SSH
@@ -66,6 +98,19 @@ private:
     std::string                     m_socket_type;
     bool                            m_is_active;
 
+    // Allocated on first read, then reused for the life of the connection.
+    std::vector<unsigned char>      m_read_buffer;
+    int                             m_read_length;
+
+    // Pending writes, flushed with a single scatter/gather send.
+    // Offset is what's already been sent from the front fragment.
+    output_buffer_queue             m_output_queue;
+    unsigned int                    m_output_offset;
+    unsigned long                   m_output_size;
+
+    admission_ticket_ptr            m_admission_ticket;
+    stream_compressor_ptr           m_compressor;
+
 };
 
 typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
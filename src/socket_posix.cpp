@@ -0,0 +1,533 @@
+#include "socket_state.hpp"
+#include "socket_handler.hpp"
+#include "logging.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <vector>
+
+#ifndef _WIN32
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#define MAX_BUFFER 16384
+
+// Linux can suppress SIGPIPE per call, others set SO_NOSIGPIPE on the socket.
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+// TCP Keepalive, half-open connections are found in minutes instead of the 2 hour default.
+#define KEEPALIVE_IDLE_SECONDS     300
+#define KEEPALIVE_INTERVAL_SECONDS 60
+#define KEEPALIVE_PROBE_COUNT      5
+
+/*
+ * Start of POSIX_Socket Derived Class (Telnet)
+ */
+
+/**
+ * @brief Non-Blocking, Close on Exec and no SIGPIPE for a new descriptor.
+ * @param socket_id
+ * @return
+ */
+static bool setupDescriptor(int socket_id)
+{
+    int flags = fcntl(socket_id, F_GETFL, 0);
+
+    if(flags == -1 || fcntl(socket_id, F_SETFL, flags | O_NONBLOCK) == -1)
+    {
+        return false;
+    }
+
+    fcntl(socket_id, F_SETFD, FD_CLOEXEC);
+
+#ifdef SO_NOSIGPIPE
+    int yes = 1;
+    setsockopt(socket_id, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+
+    return true;
+}
+
+/**
+ * @brief (Server) Take ownership of an accepted descriptor.
+ * @param socket_id
+ * @param peer_address
+ */
+void POSIX_Socket::attachSocket(int socket_id, const std::string &peer_address)
+{
+    m_socket_id = socket_id;
+    m_peer_address = peer_address;
+
+    int yes = 1;
+    setsockopt(m_socket_id, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    setsockopt(m_socket_id, SOL_SOCKET, SO_KEEPALIVE, &yes, sizeof(yes));
+
+#ifdef TCP_KEEPIDLE
+    int keepalive_idle = KEEPALIVE_IDLE_SECONDS;
+    int keepalive_interval = KEEPALIVE_INTERVAL_SECONDS;
+    int keepalive_count = KEEPALIVE_PROBE_COUNT;
+    setsockopt(m_socket_id, IPPROTO_TCP, TCP_KEEPIDLE, &keepalive_idle, sizeof(keepalive_idle));
+    setsockopt(m_socket_id, IPPROTO_TCP, TCP_KEEPINTVL, &keepalive_interval, sizeof(keepalive_interval));
+    setsockopt(m_socket_id, IPPROTO_TCP, TCP_KEEPCNT, &keepalive_count, sizeof(keepalive_count));
+#endif
+
+    if(!setupDescriptor(m_socket_id))
+    {
+        Logging *log = Logging::instance();
+        log->xrmLog<Logging::ERROR_LOG>("Unable to set socket non-blocking=", strerror(errno), __FILE__, __LINE__);
+        onExit();
+        return;
+    }
+
+    // Successful Startup
+    m_is_socket_active = true;
+}
+
+/**
+ * @brief Send Data Over the Socket
+ * @param buffer
+ * @param length
+ * @return bytes sent, 0 on errors
+ */
+int POSIX_Socket::sendSocket(unsigned char *buffer, Uint32 length)
+{
+    if(!m_is_socket_active || m_socket_id < 0)
+    {
+        return 0;
+    }
+
+    Uint32 total = 0;
+
+    while(total < length)
+    {
+        ssize_t result = send(m_socket_id, buffer + total, length - total, SEND_FLAGS);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            // Socket buffer is full, caller keeps what wasn't sent.
+            if(errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("send=", strerror(errno), __FILE__, __LINE__);
+            return 0;
+        }
+
+        total += result;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Send a list of Buffers over the Socket in a single Scatter/Gather Write.
+ *        Sends what the socket accepts and returns.
+ * @param buffers
+ * @param offset - bytes of the first buffer already sent
+ * @return bytes sent, or -1 on errors
+ */
+int POSIX_Socket::sendSocketBuffers(const output_buffer_queue &buffers, unsigned int offset)
+{
+    if(!m_is_socket_active || m_socket_id < 0)
+    {
+        return -1;
+    }
+
+    std::vector<struct iovec> io_vector;
+    io_vector.reserve(buffers.size());
+
+    for(auto &buffer : buffers)
+    {
+        if(offset >= buffer->size())
+        {
+            offset -= buffer->size();
+            continue;
+        }
+
+        struct iovec io;
+        io.iov_base = (void *)(buffer->data() + offset);
+        io.iov_len = buffer->size() - offset;
+        io_vector.push_back(io);
+        offset = 0;
+    }
+
+    int total = 0;
+    unsigned int index = 0;
+
+    while(index < io_vector.size())
+    {
+        int count = io_vector.size() - index;
+
+        if(count > IOV_MAX)
+        {
+            count = IOV_MAX;
+        }
+
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = &io_vector[index];
+        message.msg_iovlen = count;
+
+        ssize_t result = sendmsg(m_socket_id, &message, SEND_FLAGS);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            // Socket buffer is full, the rest is sent once it's writable again.
+            if(errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("sendmsg=", strerror(errno), __FILE__, __LINE__);
+            return -1;
+        }
+
+        total += result;
+
+        // Step past what was written, a partial write continues mid buffer.
+        size_t written = result;
+
+        while(index < io_vector.size() && written >= io_vector[index].iov_len)
+        {
+            written -= io_vector[index].iov_len;
+            ++index;
+        }
+
+        if(index < io_vector.size() && written > 0)
+        {
+            io_vector[index].iov_base = (char *)io_vector[index].iov_base + written;
+            io_vector[index].iov_len -= written;
+        }
+
+        if((int)result == 0)
+        {
+            break;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief Receive Waiting Socket Data
+ * @param message
+ * @return bytes read, 0 when nothing is waiting, -1 on errors or disconnect
+ */
+int POSIX_Socket::recvSocket(char *message)
+{
+    if(!m_is_socket_active || m_socket_id < 0)
+    {
+        return -1;
+    }
+
+    ssize_t result = 0;
+
+    do
+    {
+        result = recv(m_socket_id, message, MAX_BUFFER, 0);
+    }
+    while(result < 0 && errno == EINTR);
+
+    // Non-Blocking, nothing waiting to be read yet.
+    if(result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        return 0;
+    }
+
+    if(result <= 0)
+    {
+        if(result < 0)
+        {
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("recv=", strerror(errno), __FILE__, __LINE__);
+        }
+
+        m_is_socket_active = false;
+        return -1;
+    }
+
+    message[result] = 0;
+    return result;
+}
+
+/**
+ * @brief (Server) Accept a waiting connection, nullptr once the backlog is empty.
+ * @return
+ */
+socket_handler_ptr POSIX_Socket::pollSocketAccepts()
+{
+    Logging *log = Logging::instance();
+
+    if(!m_is_socket_active || m_socket_id < 0)
+    {
+        return nullptr;
+    }
+
+    struct sockaddr_storage address;
+    socklen_t address_length = sizeof(address);
+    int socket_id = -1;
+
+    do
+    {
+        socket_id = accept(m_socket_id, (struct sockaddr *)&address, &address_length);
+    }
+    while(socket_id == -1 && errno == EINTR);
+
+    if(socket_id == -1)
+    {
+        if(errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            log->xrmLog<Logging::ERROR_LOG>("accept=", strerror(errno), __FILE__, __LINE__);
+        }
+
+        return nullptr;
+    }
+
+    char host[NI_MAXHOST] = {0};
+
+    if(getnameinfo((struct sockaddr *)&address, address_length, host, sizeof(host),
+                   nullptr, 0, NI_NUMERICHOST) != 0)
+    {
+        host[0] = 0;
+    }
+
+    std::shared_ptr<POSIX_Socket> state(new POSIX_Socket(host, m_port));
+    state->attachSocket(socket_id, host);
+
+    if(!state->m_is_socket_active)
+    {
+        return nullptr;
+    }
+
+    // Setup a Handle, which will link back to Async_Connection
+    // For individual sessions and polling read/write from clients.
+    socket_handler_ptr handler(new SocketHandler());
+    handler->setSocketType("TELNET");
+    handler->setSocketState(state);
+
+    log->xrmLog<Logging::DEBUG_LOG>("Return new SocketHandler TELNET (POSIX)");
+    return handler;
+}
+
+/**
+ * @brief SDL Sockets are spawned from SDL_Socket, accepted sockets use attachSocket()
+ * @param socket
+ */
+void POSIX_Socket::spawnSocket(TCPsocket)
+{
+    Logging *log = Logging::instance();
+    log->xrmLog<Logging::ERROR_LOG>("POSIX_Socket can't spawn from an SDL socket", __FILE__, __LINE__);
+}
+
+/**
+ * @brief Poll if data is waiting (Polling loop only, the reactor waits on the descriptor)
+ * @return 1 if readable, 0 if nothing waiting, -1 on errors
+ */
+int POSIX_Socket::pollSocket()
+{
+    if(!m_is_socket_active || m_socket_id < 0)
+    {
+        return -1;
+    }
+
+    struct pollfd poll_descriptor;
+    poll_descriptor.fd = m_socket_id;
+    poll_descriptor.events = POLLIN;
+    poll_descriptor.revents = 0;
+
+    int result = poll(&poll_descriptor, 1, 0);
+
+    if(result == -1)
+    {
+        if(errno == EINTR)
+        {
+            return 0;
+        }
+
+        m_is_socket_active = false;
+        return -1;
+    }
+
+    // Hang ups are read as a disconnect.
+    return (result > 0 && poll_descriptor.revents != 0) ? 1 : 0;
+}
+
+/**
+ * @brief Socket Descriptor for registering with the IOService reactor
+ * @return
+ */
+int POSIX_Socket::getSocketId()
+{
+    return m_is_socket_active ? m_socket_id : -1;
+}
+
+/**
+ * @brief Remote IP Address of the connection
+ * @return
+ */
+std::string POSIX_Socket::getPeerAddress()
+{
+    return m_peer_address;
+}
+
+/**
+ * @brief (Client) Connect to m_host:m_port, Non-Blocking after connected.
+ * @return
+ */
+bool POSIX_Socket::onConnect()
+{
+    Logging *log = Logging::instance();
+    log->xrmLog<Logging::CONSOLE_LOG>("Client Connecting=", m_host, "port=", m_port);
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo *results = nullptr;
+    std::string port = std::to_string(m_port);
+
+    if(getaddrinfo(m_host.c_str(), port.c_str(), &hints, &results) != 0)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("getaddrinfo failed=", m_host, __FILE__, __LINE__);
+        return false;
+    }
+
+    for(struct addrinfo *address = results; address != nullptr; address = address->ai_next)
+    {
+        int socket_id = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+
+        if(socket_id == -1)
+        {
+            continue;
+        }
+
+        if(connect(socket_id, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            freeaddrinfo(results);
+            attachSocket(socket_id, m_host);
+
+            if(m_is_socket_active)
+            {
+                log->xrmLog<Logging::DEBUG_LOG>("Connection Successful");
+            }
+
+            return m_is_socket_active;
+        }
+
+        close(socket_id);
+    }
+
+    freeaddrinfo(results);
+    log->xrmLog<Logging::ERROR_LOG>("Unable to connect=", m_host, strerror(errno), __FILE__, __LINE__);
+    return false;
+}
+
+/**
+ * @brief (Server) Listen on m_port, all interfaces.
+ * @return
+ */
+bool POSIX_Socket::onListen()
+{
+    Logging *log = Logging::instance();
+    log->xrmLog<Logging::CONSOLE_LOG>("Listening for Telnet on port=", m_port);
+
+    m_socket_id = socket(AF_INET, SOCK_STREAM, 0);
+
+    if(m_socket_id == -1)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("socket=", strerror(errno), __FILE__, __LINE__);
+        return false;
+    }
+
+    int yes = 1;
+    setsockopt(m_socket_id, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+#ifdef SO_REUSEPORT
+
+    if(m_is_reuse_port && setsockopt(m_socket_id, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes)) == -1)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("SO_REUSEPORT=", strerror(errno), __FILE__, __LINE__);
+        onExit();
+        return false;
+    }
+
+#endif
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(m_port);
+
+    if(bind(m_socket_id, (struct sockaddr *)&address, sizeof(address)) == -1)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("bind=", strerror(errno), __FILE__, __LINE__);
+        onExit();
+        return false;
+    }
+
+    if(listen(m_socket_id, SOMAXCONN) == -1)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("listen=", strerror(errno), __FILE__, __LINE__);
+        onExit();
+        return false;
+    }
+
+    if(!setupDescriptor(m_socket_id))
+    {
+        log->xrmLog<Logging::ERROR_LOG>("Unable to set listener non-blocking=", strerror(errno), __FILE__, __LINE__);
+        onExit();
+        return false;
+    }
+
+    // Successful Startup
+    m_is_socket_active = true;
+    return true;
+}
+
+/**
+ * @brief Shutdown Socket.
+ * @return
+ */
+bool POSIX_Socket::onExit()
+{
+    if(m_socket_id != -1)
+    {
+        close(m_socket_id);
+    }
+
+    m_socket_id = -1;
+    m_is_socket_active = false;
+    return true;
+}
+
+#endif // _WIN32
@@ -102,6 +102,16 @@ int SSH_Socket::pollSocket()
     return num_ready;
 }
 
+/**
+ * @brief libssh buffers decrypted channel data internally, so readiness on
+ *        the descriptor doesn't match data available, SSH is polled instead.
+ * @return
+ */
+int SSH_Socket::getSocketId()
+{
+    return -1;
+}
+
 bool SSH_Socket::onConnect()
 {
     // For testing and getting debugging output
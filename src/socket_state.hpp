@@ -9,9 +9,12 @@
 #include <sdl2_net/SDL_net.hpp>
 #include <libssh/libssh.h>
 
+#include "output_buffer.hpp"
+
 #include <iostream>
 #include <memory>
 #include <string>
+#include <deque>
 
 class SocketHandler;
 typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
@@ -42,10 +45,44 @@ public:
     virtual socket_handler_ptr pollSocketAccepts() = 0;
     virtual void spawnSocket(TCPsocket socket) = 0;
     virtual int pollSocket() = 0;
+    virtual int getSocketId() = 0;
     virtual bool onConnect() = 0;
     virtual bool onListen() = 0;
     virtual bool onExit() = 0;
 
+    /**
+     * @brief Remote IP Address of the connection, empty when unknown.
+     * @return
+     */
+    virtual std::string getPeerAddress()
+    {
+        return "";
+    }
+
+    /**
+     * @brief Send a list of buffers in one call, default joins them for a single send.
+     * @param buffers
+     * @param offset - bytes of the first buffer already sent
+     * @return bytes sent, or -1 on errors
+     */
+    virtual int sendSocketBuffers(const output_buffer_queue &buffers, unsigned int offset)
+    {
+        std::string output;
+
+        for(auto &buffer : buffers)
+        {
+            output += *buffer;
+        }
+
+        if(offset >= output.size())
+        {
+            return 0;
+        }
+
+        int result = sendSocket((unsigned char *)output.c_str() + offset, output.size() - offset);
+        return (result > 0) ? result : -1;
+    }
+
     std::string m_host;
     int         m_port;
     bool        m_is_socket_active;
@@ -69,17 +106,30 @@ public:
         : SocketState(host, port)
         , m_tcp_socket(nullptr)
         , m_socket_set(nullptr)
+        , m_is_reuse_port(false)
     { }
 
     virtual ~SDL_Socket()
     {
     }
 
+    /**
+     * @brief Listen with SO_REUSEPORT, one listener per IOService loop.
+     * @param is_reuse_port
+     */
+    void setReusePort(bool is_reuse_port)
+    {
+        m_is_reuse_port = is_reuse_port;
+    }
+
     virtual int sendSocket(unsigned char *message, Uint32 len);
+    virtual int sendSocketBuffers(const output_buffer_queue &buffers, unsigned int offset);
     virtual int recvSocket(char *message);
     virtual socket_handler_ptr pollSocketAccepts();
     virtual void spawnSocket(TCPsocket socket);
     virtual int pollSocket();
+    virtual int getSocketId();
+    virtual std::string getPeerAddress();
     virtual bool onConnect();
     virtual bool onListen();
     virtual bool onExit();
@@ -88,6 +138,7 @@ private:
 
     TCPsocket        m_tcp_socket;
     SDLNet_SocketSet m_socket_set;
+    bool             m_is_reuse_port;
 
 };
 
@@ -175,6 +226,68 @@ private:
 };
 */
 
+/**
+ * @class POSIX_Socket
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file socket_state.hpp
+ * @brief Plain Non-Blocking POSIX / TCP Telnet Socket
+ *        Registers it's descriptor with the IOService reactor directly,
+ *        no socket set or select() so there's no FD_SETSIZE limit.
+ */
+class POSIX_Socket : public SocketState
+{
+public:
+
+    POSIX_Socket(const std::string &host, const int &port)
+        : SocketState(host, port)
+        , m_socket_id(-1)
+        , m_peer_address("")
+        , m_is_reuse_port(false)
+    { }
+
+    virtual ~POSIX_Socket()
+    {
+        onExit();
+    }
+
+    /**
+     * @brief Listen with SO_REUSEPORT, one listener per IOService loop.
+     * @param is_reuse_port
+     */
+    void setReusePort(bool is_reuse_port)
+    {
+        m_is_reuse_port = is_reuse_port;
+    }
+
+    /**
+     * @brief (Server) Take ownership of an accepted descriptor.
+     * @param socket_id
+     * @param peer_address
+     */
+    void attachSocket(int socket_id, const std::string &peer_address);
+
+    virtual int sendSocket(unsigned char *message, Uint32 len);
+    virtual int sendSocketBuffers(const output_buffer_queue &buffers, unsigned int offset);
+    virtual int recvSocket(char *message);
+    virtual socket_handler_ptr pollSocketAccepts();
+    virtual void spawnSocket(TCPsocket socket);
+    virtual int pollSocket();
+    virtual int getSocketId();
+    virtual std::string getPeerAddress();
+    virtual bool onConnect();
+    virtual bool onListen();
+    virtual bool onExit();
+
+private:
+
+    int         m_socket_id;
+    std::string m_peer_address;
+    bool        m_is_reuse_port;
+
+};
+
+
 /**
  * @class SSH_Socket
  * @author Michael Griffin
@@ -204,6 +317,7 @@ public:
     virtual socket_handler_ptr pollSocketAccepts();
     virtual void spawnSocket(TCPsocket socket);
     virtual int pollSocket();
+    virtual int getSocketId();
     virtual bool onConnect();
     virtual bool onListen();
     virtual bool onExit();
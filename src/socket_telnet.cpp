@@ -11,6 +11,13 @@
 #include <cerrno>
 #include <time.h>
 
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <climits>
+#include <vector>
+#endif
+
 #define MAX_BUFFER 16384
 
 /**
@@ -25,20 +32,109 @@ int SDL_Socket::sendSocket(unsigned char *buffer, Uint32 length)
 
     if(m_is_socket_active)
     {
+        // Clear any message left from an earlier call, so it's not mistaken for this send's.
+        SDLNet_SetError("");
         result = SDLNet_TCP_Send(m_tcp_socket, buffer, length);
 
-        if(result < (signed)strlen((char *)buffer))
+        // A short send is still the bytes that went out, only nothing sent is an error.
+        if(result <= 0)
         {
-            if(SDLNet_GetError() && strlen(SDLNet_GetError()))
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("SDLNet_TCP_Send=", result, SDLNet_GetError(), __FILE__, __LINE__);
+            return(0);
+        }
+    }
+
+    return(result);
+}
+
+/**
+ * @brief Send a list of Buffers over the Socket in a single Scatter/Gather Write.
+ *        The socket is non-blocking, sends what the socket accepts and returns.
+ * @param buffers
+ * @param offset - bytes of the first buffer already sent
+ * @return bytes sent, or -1 on errors
+ */
+int SDL_Socket::sendSocketBuffers(const output_buffer_queue &buffers, unsigned int offset)
+{
+#ifdef _WIN32
+    return SocketState::sendSocketBuffers(buffers, offset);
+#else
+    int socket_id = getSocketId();
+
+    if(socket_id < 0)
+    {
+        return -1;
+    }
+
+    std::vector<struct iovec> io_vector;
+    io_vector.reserve(buffers.size());
+
+    for(auto &buffer : buffers)
+    {
+        if(offset >= buffer->size())
+        {
+            offset -= buffer->size();
+            continue;
+        }
+
+        struct iovec io;
+        io.iov_base = (void *)(buffer->data() + offset);
+        io.iov_len = buffer->size() - offset;
+        io_vector.push_back(io);
+        offset = 0;
+    }
+
+    int total_sent = 0;
+    unsigned int index = 0;
+
+    while(index < io_vector.size())
+    {
+        int count = io_vector.size() - index;
+
+        if(count > IOV_MAX)
+        {
+            count = IOV_MAX;
+        }
+
+        ssize_t result = writev(socket_id, &io_vector[index], count);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            // Socket buffer is full, the rest is sent once it's writable again.
+            if(errno == EAGAIN || errno == EWOULDBLOCK)
             {
-                Logging *log = Logging::instance();
-                log->xrmLog<Logging::ERROR_LOG>("SDLNet_TCP_Send=", SDLNet_GetError(), __FILE__, __LINE__);
-                return(0);
+                break;
             }
+
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("writev=", strerror(errno), __FILE__, __LINE__);
+            return -1;
+        }
+
+        total_sent += result;
+
+        // Skip buffers sent in full, a partial buffer continues where it left off.
+        while(index < io_vector.size() && result >= (ssize_t)io_vector[index].iov_len)
+        {
+            result -= io_vector[index].iov_len;
+            ++index;
+        }
+
+        if(index < io_vector.size() && result > 0)
+        {
+            io_vector[index].iov_base = (char *)io_vector[index].iov_base + result;
+            io_vector[index].iov_len -= result;
         }
     }
 
-    return(result);
+    return total_sent;
+#endif
 }
 
 /**
@@ -54,6 +150,16 @@ int SDL_Socket::recvSocket(char *message)
     {
         result = SDLNet_TCP_Recv(m_tcp_socket, message, MAX_BUFFER);
 
+#ifndef _WIN32
+
+        // Non-Blocking, nothing waiting to be read yet.
+        if(result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return 0;
+        }
+
+#endif
+
         if(result <= 0)
         {
             // -1 is Error 0 is Server Closed Connection
@@ -97,6 +203,45 @@ int SDL_Socket::pollSocket()
     return num_ready;
 }
 
+/**
+ * @brief Remote IP Address (dotted quad) of the connection
+ * @return
+ */
+std::string SDL_Socket::getPeerAddress()
+{
+    if(!m_tcp_socket)
+    {
+        return "";
+    }
+
+    IPaddress *address = SDLNet_TCP_GetPeerAddress(m_tcp_socket);
+
+    if(!address)
+    {
+        return "";
+    }
+
+    // Host is in network byte order.
+    const unsigned char *octets = (const unsigned char *)&address->host;
+    char buffer[16] = {0};
+    snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return buffer;
+}
+
+/**
+ * @brief Socket Descriptor for registering with the IOService reactor
+ * @return
+ */
+int SDL_Socket::getSocketId()
+{
+    if(m_is_socket_active && m_tcp_socket)
+    {
+        return SDLNet_TCP_GetSocketId(m_tcp_socket);
+    }
+
+    return -1;
+}
+
 /**
  * @brief Polls For Data To Read from the socket.
  * @return
@@ -106,19 +251,14 @@ socket_handler_ptr SDL_Socket::pollSocketAccepts()
     Logging *log = Logging::instance();
     TCPsocket socket = nullptr;
 
-    int numActiveSockets = SDLNet_CheckSockets(m_socket_set, 0);
-
-    if(numActiveSockets != 0)
+    // Listener is Non-Blocking, accept directly and return nullptr once the
+    // Backlog is empty, so the caller can drain every pending connection.
+    if(m_is_socket_active && m_tcp_socket)
     {
-        log->xrmLog<Logging::DEBUG_LOG>("pollSocketAccepts=", numActiveSockets, "with data to be processed");
-    }
+        socket = SDLNet_TCP_Accept(m_tcp_socket);
 
-    if(numActiveSockets > 0 && m_is_socket_active)
-    {
-        if(SDLNet_SocketReady(m_tcp_socket) != 0)
+        if(socket)
         {
-            socket = SDLNet_TCP_Accept(m_tcp_socket);
-
             // Setup the State, SDL_Socket
             config_ptr config = TheCommunicator::instance()->getConfiguration();
             socket_state_ptr state(new SDL_Socket("127.0.0.1", config->port_telnet));
@@ -163,6 +303,19 @@ void SDL_Socket::spawnSocket(TCPsocket socket)
         return;
     }
 
+#ifndef _WIN32
+
+    // Sessions are Non-Blocking, a slow client can't stall the IOService loop.
+    int socket_id = SDLNet_TCP_GetSocketId(m_tcp_socket);
+    int flags = fcntl(socket_id, F_GETFL, 0);
+
+    if(flags == -1 || fcntl(socket_id, F_SETFL, flags | O_NONBLOCK) == -1)
+    {
+        log->xrmLog<Logging::ERROR_LOG>("Unable to set socket non-blocking=", strerror(errno), __FILE__, __LINE__);
+    }
+
+#endif
+
     // Successful Startup
     m_is_socket_active = true;
     log->xrmLog<Logging::DEBUG_LOG>("Connection Spawn Successful");
@@ -247,7 +400,7 @@ bool SDL_Socket::onListen()
         return false;
     }
 
-    m_tcp_socket = SDLNet_TCP_Open(&ip);
+    m_tcp_socket = SDLNet_TCP_OpenServer(&ip, m_is_reuse_port ? 1 : 0);
 
     if(!m_tcp_socket)
     {
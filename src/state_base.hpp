@@ -2,6 +2,7 @@
 #define THE_STATE_HPP
 
 #include "session_data.hpp"
+#include "glyph_span.hpp"
 
 #include <memory>
 #include <iostream>
@@ -27,6 +28,22 @@ public:
     virtual void resume() {}
     virtual std::string getStateID() const = 0;
 
+    /**
+     * @brief Batched Input, takes one or more glyphs from the run.
+     *        By default a single glyph is passed to update().
+     * @param glyphs
+     */
+    virtual void updateGlyphs(GlyphSpan &glyphs)
+    {
+        std::string glyph;
+        bool is_utf8 = false;
+
+        if(glyphs.next(glyph, is_utf8))
+        {
+            update(glyph, is_utf8);
+        }
+    }
+
     explicit StateBase(session_data_ptr session_data)
         : m_session_data(session_data)
         , m_is_active(false)
@@ -1,6 +1,5 @@
 #include "state_manager.hpp"
 #include "logging.hpp"
-#include "utf-cpp/utf8.h"
 
 #include <cstring>
 #include <string>
@@ -27,81 +26,42 @@ void StateManager::clean()
  * @brief Parses Incoming Strings, Sepeates into single character
  * strings of single ASCII charactrs or UTF-8 multi-byte sequence
  *
- * Each Code point is a individual UTF8 Character
- * which is copied from code_point to char[5] array.
+ * The whole run is passed to the State, which takes one or more
+ * glyphs at a time, the State is checked again after each pass
+ * as input can switch it.
  */
 void StateManager::update()
 {
-    std::string new_string_builder = "";
-    bool utf_found = false;
+    if(m_the_state.empty())
+    {
+        return;
+    }
 
-    if(!m_the_state.empty())
+    session_data_ptr session_data = m_the_state.back()->m_session_data;
+    std::string incoming_data = std::move(session_data->m_parsed_data);
+    GlyphSpan glyphs(incoming_data);
+
+    while(!glyphs.empty() && !m_the_state.empty())
     {
-        std::string incoming_data = std::move(m_the_state.back()->m_session_data->m_parsed_data);
+        std::string::size_type remaining = glyphs.getRemaining();
+        state_ptr current_state = m_the_state.back();
+        current_state->updateGlyphs(glyphs);
 
-        if(incoming_data.size() > 0)
+        // A State that didn't take any input would never let us out.
+        if(glyphs.getRemaining() == remaining)
         {
-            std::string::iterator it = incoming_data.begin();
-            std::string::iterator line_end = incoming_data.end();
-
-            /**
-             * This loops a string, each next should be a single character code point.
-             */
-            while(it != line_end)
-            {
-                int byte_value = static_cast<int>((uint8_t)*it);
-
-                if(byte_value < 128)
-                {
-                    utf_found = false;
-                    *it++;
-
-                    // Only if ESC and next char is empty
-                    // Then we want to pass both to registed single ESC hit
-                    if(byte_value == '\x1b' && *it == '\0')
-                    {
-                        new_string_builder += '\x1b';
-                        m_the_state.back()->update(new_string_builder, utf_found);
-
-                        new_string_builder = '\0';
-                        m_the_state.back()->update(new_string_builder, utf_found);
-                        new_string_builder.erase();
-                        continue;
-                    }
-
-                    new_string_builder += std::string(1, byte_value);
-                }
-                else
-                {
-                    try
-                    {
-                        // Only gets here on multi-byte sequences.
-                        uint32_t code_point = utf8::next(it, line_end);
-                        unsigned char character[5] = {0, 0, 0, 0, 0};
-                        utf8::append(code_point, character);
-
-                        for(int i = 0; i < 5; i++)
-                        {
-                            if(character[i] != 0)
-                            {
-                                new_string_builder += std::string(1, character[i]);
-                            }
-                        }
-
-                        utf_found = true;
-                    }
-                    catch(utf8::exception &ex)
-                    {
-                        Logging *log = Logging::instance();
-                        log->xrmLog<Logging::ERROR_LOG>("Utf8 Parsing Exception=", ex.what(), __LINE__, __FILE__);
-                    }
-                }
-
-                m_the_state.back()->update(new_string_builder, utf_found);
-                new_string_builder.erase();
-            }
+            Logging *log = Logging::instance();
+            log->xrmLog<Logging::ERROR_LOG>("State took no input, remaining input dropped", __LINE__, __FILE__);
+            break;
         }
     }
+
+    // Hand the buffer back, it's capacity is reused by the next read.
+    if(session_data->m_parsed_data.empty())
+    {
+        incoming_data.clear();
+        session_data->m_parsed_data.swap(incoming_data);
+    }
 }
 
 /**
@@ -0,0 +1,197 @@
+#ifndef STREAM_COMPRESSOR_HPP
+#define STREAM_COMPRESSOR_HPP
+
+#include <zlib.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class StreamCompressor
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file stream_compressor.hpp
+ * @brief Streaming zlib Deflate (RFC1950) for Telnet MCCP2 output.
+ *        One per connection, writes are deflated as they're queued and sync
+ *        flushed once per send, so the client can paint each burst right away.
+ *        Not Thread Safe, used by the IOService loop.
+ */
+class StreamCompressor
+{
+public:
+
+    StreamCompressor()
+        : m_stream()
+        , m_is_active(false)
+        , m_is_flush_needed(false)
+        , m_buffer()
+        , m_output("")
+    {
+        memset(&m_stream, 0, sizeof(m_stream));
+    }
+
+    StreamCompressor(const StreamCompressor&) = delete;
+    StreamCompressor& operator=(const StreamCompressor&) = delete;
+
+    ~StreamCompressor()
+    {
+        if(m_is_active)
+        {
+            deflateEnd(&m_stream);
+        }
+    }
+
+    /**
+     * @brief Setup the deflate context, window and hash sizes are picked
+     *        to fit zlib's memory usage under the limit.
+     * @param level - 1 (fastest) to 9 (best)
+     * @param memory_limit_kb - Deflate state per connection.
+     * @return
+     */
+    bool start(int level, int memory_limit_kb)
+    {
+        if(m_is_active)
+        {
+            return true;
+        }
+
+        int window_bits = 15;
+        int memory_level = 9;
+        long memory_limit = (long)memory_limit_kb * 1024L;
+
+        // zlib deflate memory = (1 << (window_bits + 2)) + (1 << (memory_level + 9))
+        while(deflateMemory(window_bits, memory_level) > memory_limit && (window_bits > 9 || memory_level > 1))
+        {
+            if(memory_level > 1 && memory_level + 7 >= window_bits)
+            {
+                --memory_level;
+            }
+            else
+            {
+                --window_bits;
+            }
+        }
+
+        if(level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION)
+        {
+            level = Z_DEFAULT_COMPRESSION;
+        }
+
+        if(deflateInit2(&m_stream, level, Z_DEFLATED, window_bits, memory_level, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            return false;
+        }
+
+        m_buffer.resize(BUFFER_SIZE);
+        m_is_active = true;
+        return true;
+    }
+
+    /**
+     * @brief Compress a block of output, held until the next flush.
+     *        zlib keeps most of it back to compress with what follows.
+     * @param input
+     * @return
+     */
+    bool compress(const std::string &input)
+    {
+        if(!m_is_active)
+        {
+            return false;
+        }
+
+        m_stream.next_in = (Bytef *)input.data();
+        m_stream.avail_in = input.size();
+        m_is_flush_needed = true;
+
+        return deflateInput(Z_NO_FLUSH);
+    }
+
+    /**
+     * @brief Sync Flush everything compressed since the last flush.
+     * @param output - Replaced with the compressed bytes.
+     * @return
+     */
+    bool flush(std::string &output)
+    {
+        if(!m_is_active)
+        {
+            return false;
+        }
+
+        m_stream.next_in = nullptr;
+        m_stream.avail_in = 0;
+
+        if(!deflateInput(Z_SYNC_FLUSH))
+        {
+            return false;
+        }
+
+        m_is_flush_needed = false;
+        output.clear();
+        output.swap(m_output);
+        return true;
+    }
+
+    /**
+     * @brief Check if output was compressed and not yet flushed.
+     * @return
+     */
+    bool isFlushNeeded() const
+    {
+        return m_is_flush_needed;
+    }
+
+    bool isActive() const
+    {
+        return m_is_active;
+    }
+
+private:
+
+    static const int BUFFER_SIZE = 16384;
+
+    /**
+     * @brief Runs deflate until zlib has room to spare, all input is then
+     *        taken and a flush is complete.
+     * @param flush
+     * @return
+     */
+    bool deflateInput(int flush)
+    {
+        do
+        {
+            m_stream.next_out = &m_buffer[0];
+            m_stream.avail_out = m_buffer.size();
+
+            if(deflate(&m_stream, flush) == Z_STREAM_ERROR)
+            {
+                return false;
+            }
+
+            m_output.append((const char *)&m_buffer[0], m_buffer.size() - m_stream.avail_out);
+        }
+        while(m_stream.avail_out == 0);
+
+        return true;
+    }
+
+    static long deflateMemory(int window_bits, int memory_level)
+    {
+        return (1L << (window_bits + 2)) + (1L << (memory_level + 9));
+    }
+
+    z_stream                   m_stream;
+    bool                       m_is_active;
+    bool                       m_is_flush_needed;
+
+    // Reused for every deflate call, compressed bytes collect in m_output until flushed.
+    std::vector<unsigned char> m_buffer;
+    std::string                m_output;
+};
+
+typedef std::shared_ptr<StreamCompressor> stream_compressor_ptr;
+
+#endif // STREAM_COMPRESSOR_HPP
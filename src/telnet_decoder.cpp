@@ -3,6 +3,7 @@
 #include "logging.hpp"
 
 #include <cstdio>
+#include <cstring>
 #include <string>
 #include <fstream>
 
@@ -66,10 +67,10 @@ void TelnetDecoder::decodeBuffer()
     log->xrmLog<Logging::DEBUG_LOG>("decodeByffer 240 - SE received");
 
     // Check if this was a sequence we were waiting for.
+    // TTYPE and NAWS are only answered once their data is received.
     if(checkReply(m_subnegoOption))
     {
-        // Remove it
-        //del_reply(m_subnegoOption);
+        deleteReply(m_subnegoOption);
     }
 
     // Now process the buffer per the options
@@ -107,6 +108,73 @@ void TelnetDecoder::decodeBuffer()
     m_subnegoOption = 0;
 }
 
+/**
+ * @brief Copy a run of text in bulk, dropping NULL bytes.
+ * @param start
+ * @param end
+ * @param output
+ */
+static void appendTextRun(const unsigned char *start, const unsigned char *end, std::string &output)
+{
+    while(start < end)
+    {
+        const unsigned char *null_byte = (const unsigned char *)memchr(start, '\0', end - start);
+        const unsigned char *stop = null_byte ? null_byte : end;
+
+        output.append((const char *)start, stop - start);
+        start = null_byte ? null_byte + 1 : end;
+    }
+}
+
+/**
+ * @brief Parse a block of Incoming Data, text between commands is found with
+ *        memchr() and copied in bulk, only command sequences are parsed per byte.
+ * @param buffer
+ * @param length
+ * @param output
+ */
+void TelnetDecoder::decodeInput(const unsigned char *buffer, int length, std::string &output)
+{
+    const unsigned char *position = buffer;
+    const unsigned char *end = buffer + length;
+
+    output.reserve(output.size() + length);
+
+    while(position < end)
+    {
+        // Inside a command sequence, or starting one.
+        if(m_teloptStage != 0 || *position == IAC)
+        {
+            unsigned char ch = '\0';
+
+            try
+            {
+                ch = telnetOptionParse(*position++);
+            }
+            catch(std::exception& e)
+            {
+                // Only this byte is lost, the rest of the input is still decoded.
+                Logging *log = Logging::instance();
+                log->xrmLog<Logging::ERROR_LOG>("Exception telnetOptionParse", e.what(), __LINE__, __FILE__);
+            }
+
+            // Nulls are returned on Telnet options, no text data.
+            if(ch != '\0')
+            {
+                output += ch;
+            }
+
+            continue;
+        }
+
+        const unsigned char *command = (const unsigned char *)memchr(position, IAC, end - position);
+        const unsigned char *run_end = command ? command : end;
+
+        appendTextRun(position, run_end, output);
+        position = run_end;
+    }
+}
+
 /**
  * @brief Parse Telnet Commands/Options from Incoming Data.
  *        Also handles responses to clients
@@ -312,6 +380,22 @@ unsigned char TelnetDecoder::telnetOptionParse(unsigned char c)
                         case TELOPT_NAWS:
                             break;
 
+                        // Only when offered, everything sent after the reply is compressed.
+                        case TELOPT_MCCP_2:
+                            if(!checkReply(c))
+                            {
+                                log->xrmLog<Logging::DEBUG_LOG>("[IAC] DO MCCP2 -> WONT", (int)m_teloptCommand, (int)c);
+                                sendIACSequences(telnetOptionDeny(m_teloptCommand),c);
+                            }
+                            else
+                            {
+                                log->xrmLog<Logging::DEBUG_LOG>("[IAC] DO MCCP2 REPLY", (int)m_teloptCommand, (int)c);
+                                deleteReply(c);
+                                startCompression();
+                            }
+
+                            break;
+
                         case TELOPT_LINEMODE:
                             if(!checkReply(c))
                             {
@@ -36,6 +36,7 @@ public:
         , m_is_echo(false)
         , m_is_sga(false)
         , m_is_linemode(false)
+        , m_is_compressing(false)
         , m_teloptStage(0)
         , m_teloptCommand(0)
         , m_currentOption(0)
@@ -84,6 +85,16 @@ public:
         addSequence(reply_sequence, option);
     }
 
+    /**
+     * @brief All options sent have been answered, or refused, and
+     *        TTYPE / NAWS Sub-Negotiation data has been received.
+     * @return
+     */
+    bool isNegotiationComplete() const
+    {
+        return reply_sequence.empty();
+    }
+
     /**
      * @brief handles active sequences negotiated.
      * @param option
@@ -104,6 +115,7 @@ public:
 
     void decodeBuffer();
     unsigned char telnetOptionParse(unsigned char c);
+    void decodeInput(const unsigned char *buffer, int length, std::string &output);
 
     int getTermRows() const
     {
@@ -131,6 +143,7 @@ private:
     bool        m_is_echo;
     bool        m_is_sga;
     bool        m_is_linemode;
+    bool        m_is_compressing;
 
     // Global Option State for Telnet Options Parsing.
     int m_teloptStage;
@@ -186,6 +199,29 @@ private:
 
     }
 
+    /**
+     * @brief Start MCCP2, IAC SB COMPRESS2 IAC SE is the last uncompressed output.
+     */
+    void startCompression()
+    {
+        if(m_is_compressing)
+        {
+            return;
+        }
+
+        if(m_connection->getSocketHandle()->isActive() && TheCommunicator::instance()->isActive())
+        {
+            std::string sequence = { (char)IAC, (char)SB, (char)TELOPT_MCCP_2, (char)IAC, (char)SE };
+            m_is_compressing = true;
+            m_connection->asyncCompress(sequence,
+                                        std::bind(
+                                            &TelnetDecoder::handleWrite,
+                                            shared_from_this(),
+                                            std::placeholders::_1,
+                                            std::placeholders::_2));
+        }
+    }
+
     /**
      * @brief Send Specific IAC TTYPE Message
      */
@@ -292,25 +328,12 @@ private:
         typename T::iterator it =
             find_if(t.begin(), t.end(), FindFirst(option));
 
-        typename T::iterator it_back = t.end();
-
-        if(t.size() == 0)
-        {
-            return;
-        }
-        else if(t.size() > 1)
+        // If Sequence Found, Swap to Back and Remove Back.
+        // Only one is removed, an option can be waiting on both WILL and DO.
+        if(it != t.end())
         {
-            // If Sequence Found, Swap to Back and Remove Back.
-            if(it != t.end())
-            {
-                iter_swap(it, it_back);
-                t.pop_back();
-            }
-            else
-            {
-                // Clear all.
-                std::vector<unsigned char>().swap(t);
-            }
+            iter_swap(it, t.end() - 1);
+            t.pop_back();
         }
     }
 };
@@ -0,0 +1,363 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include "intrusive_list.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @class TimerEntry
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file timer_wheel.hpp
+ * @brief A single scheduled callback, the handle returned for canceling it.
+ */
+class TimerEntry
+    : public IntrusiveListHook<TimerEntry>
+{
+public:
+
+    typedef std::function<void()> callback_function_handler;
+
+    TimerEntry(std::chrono::steady_clock::time_point deadline, callback_function_handler callback)
+        : m_deadline(deadline)
+        , m_callback(callback)
+        , m_expires_tick(0)
+        , m_is_cancelled(false)
+    {
+    }
+
+    /**
+     * @brief Cancel from any thread, the callback won't be executed.
+     */
+    void cancel()
+    {
+        m_is_cancelled = true;
+    }
+
+    bool isCancelled() const
+    {
+        return m_is_cancelled;
+    }
+
+    std::chrono::steady_clock::time_point m_deadline;
+    callback_function_handler             m_callback;
+    unsigned long                         m_expires_tick;
+
+private:
+
+    std::atomic_bool m_is_cancelled;
+};
+
+typedef std::shared_ptr<TimerEntry> timer_entry_ptr;
+
+/**
+ * @class TimerWheel
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file timer_wheel.hpp
+ * @brief Hierarchical Timer Wheel, driven by a single IOService loop (Not Thread Safe)
+ *        Timers due within one turn hash into a 10ms slot by expire tick.  Longer
+ *        waits go in an overflow level with one slot per turn, and are cascaded
+ *        down as their turn starts.  Waits longer then the overflow level stay in
+ *        it's slot for more then one turn of the overflow wheel.
+ */
+class TimerWheel
+{
+public:
+
+    static const int TICK_MILLISECONDS = 10;
+    static const int WHEEL_SLOTS       = 512;
+    static const int OVERFLOW_SLOTS    = 64;
+
+    TimerWheel()
+        : m_slots(WHEEL_SLOTS)
+        , m_overflow_slots(OVERFLOW_SLOTS)
+        , m_start(std::chrono::steady_clock::now())
+        , m_current_tick(0)
+        , m_size(0)
+        , m_next_tick(0)
+        , m_is_next_tick_valid(false)
+    {
+    }
+
+    ~TimerWheel()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Add a Timer to it's slot, ticks are rounded up so it's never early.
+     * @param timer
+     */
+    void schedule(timer_entry_ptr timer)
+    {
+        if(!timer || timer->isCancelled())
+        {
+            return;
+        }
+
+        unsigned long tick = tickAt(timer->m_deadline, true);
+
+        // Already due, runs on the next advance.
+        if(tick <= m_current_tick)
+        {
+            tick = m_current_tick + 1;
+        }
+
+        timer->m_expires_tick = tick;
+        ++m_size;
+
+        if(tick > m_current_tick + WHEEL_SLOTS)
+        {
+            m_overflow_slots[(tick / WHEEL_SLOTS) % OVERFLOW_SLOTS].push_back(timer);
+
+            if(m_is_next_tick_valid && tick < m_next_tick)
+            {
+                m_next_tick = tick;
+            }
+
+            return;
+        }
+
+        m_slots[tick % WHEEL_SLOTS].push_back(timer);
+
+        if(m_is_next_tick_valid && tick < m_next_tick)
+        {
+            m_next_tick = tick;
+        }
+    }
+
+    /**
+     * @brief Runs the callbacks of all timers due up to now.
+     * @param now
+     * @return Number of callbacks executed.
+     */
+    int advance(std::chrono::steady_clock::time_point now)
+    {
+        unsigned long target_tick = tickAt(now, false);
+        int executed = 0;
+
+        while(m_size > 0 && m_current_tick < target_tick)
+        {
+            ++m_current_tick;
+
+            // Start of a turn, bring down the overflow timers due in it.
+            if(m_current_tick % WHEEL_SLOTS == 0)
+            {
+                cascade();
+            }
+
+            IntrusiveList<TimerEntry> &slot = m_slots[m_current_tick % WHEEL_SLOTS];
+            TimerEntry *next_timer = nullptr;
+
+            for(TimerEntry *timer = slot.front(); timer != nullptr; timer = next_timer)
+            {
+                next_timer = slot.next(timer);
+
+                if(timer->isCancelled())
+                {
+                    // Drop the callback, the handle can outlive it's slot.
+                    slot.remove(timer)->m_callback = nullptr;
+                    --m_size;
+                    continue;
+                }
+
+                // Scheduled during this tick for the next turn.
+                if(timer->m_expires_tick > m_current_tick)
+                {
+                    continue;
+                }
+
+                timer_entry_ptr expired = slot.remove(timer);
+                --m_size;
+
+                if(expired->m_callback)
+                {
+                    expired->m_callback();
+                    ++executed;
+                }
+
+                // Release what the callback captured, it never runs again.
+                expired->m_callback = nullptr;
+            }
+        }
+
+        // Nothing waiting, catch up so the next timer doesn't walk empty slots.
+        if(m_size == 0 && m_current_tick < target_tick)
+        {
+            m_current_tick = target_tick;
+        }
+
+        return executed;
+    }
+
+    /**
+     * @brief Milliseconds until the next timer is due, -1 if there are none.
+     *        Used as the reactor's wait timeout, the next tick is cached until
+     *        it's reached, so the slots are only walked once per timer.
+     * @param now
+     * @return
+     */
+    int millisecondsUntilNext(std::chrono::steady_clock::time_point now) const
+    {
+        if(m_size == 0)
+        {
+            return -1;
+        }
+
+        if(!m_is_next_tick_valid || m_next_tick <= m_current_tick)
+        {
+            m_next_tick = m_current_tick + WHEEL_SLOTS;
+
+            for(unsigned long tick = m_current_tick + 1; tick < m_current_tick + WHEEL_SLOTS; tick++)
+            {
+                if(!m_slots[tick % WHEEL_SLOTS].is_empty())
+                {
+                    m_next_tick = tick;
+                    break;
+                }
+            }
+
+            // Overflow timers can be due before the wheel's.
+            unsigned long overflow_tick = nextOverflowTick();
+
+            if(overflow_tick < m_next_tick)
+            {
+                m_next_tick = overflow_tick;
+            }
+
+            m_is_next_tick_valid = true;
+        }
+
+        unsigned long now_tick = tickAt(now, false);
+        return (m_next_tick <= now_tick) ? 0 : (int)(m_next_tick - now_tick) * TICK_MILLISECONDS;
+    }
+
+    bool is_empty() const
+    {
+        return m_size == 0;
+    }
+
+    unsigned long size() const
+    {
+        return m_size;
+    }
+
+    void clear()
+    {
+        for(auto &slot : m_slots)
+        {
+            slot.clear();
+        }
+
+        for(auto &slot : m_overflow_slots)
+        {
+            slot.clear();
+        }
+
+        m_size = 0;
+        m_is_next_tick_valid = false;
+    }
+
+private:
+
+    /**
+     * @brief Moves the overflow timers due in the turn starting now down to their slots.
+     *        Cancelled timers are dropped, later turns are left for the next pass.
+     */
+    void cascade()
+    {
+        unsigned long turn = m_current_tick / WHEEL_SLOTS;
+        IntrusiveList<TimerEntry> &overflow = m_overflow_slots[turn % OVERFLOW_SLOTS];
+        TimerEntry *next_timer = nullptr;
+
+        for(TimerEntry *timer = overflow.front(); timer != nullptr; timer = next_timer)
+        {
+            next_timer = overflow.next(timer);
+
+            if(timer->isCancelled())
+            {
+                overflow.remove(timer)->m_callback = nullptr;
+                --m_size;
+                continue;
+            }
+
+            if(timer->m_expires_tick / WHEEL_SLOTS != turn)
+            {
+                continue;
+            }
+
+            timer_entry_ptr due = overflow.remove(timer);
+            m_slots[due->m_expires_tick % WHEEL_SLOTS].push_back(due);
+
+            // The cached next tick was the start of this turn.
+            m_is_next_tick_valid = false;
+        }
+    }
+
+    /**
+     * @brief Earliest expire tick in the nearest overflow turn that has timers.
+     *        Only that slot is walked, timers in it for a later turn are skipped.
+     * @return
+     */
+    unsigned long nextOverflowTick() const
+    {
+        unsigned long turn = m_current_tick / WHEEL_SLOTS;
+        unsigned long next_tick = ~0UL;
+
+        for(unsigned long next_turn = turn + 1; next_turn <= turn + OVERFLOW_SLOTS; next_turn++)
+        {
+            const IntrusiveList<TimerEntry> &overflow = m_overflow_slots[next_turn % OVERFLOW_SLOTS];
+
+            for(TimerEntry *timer = overflow.front(); timer != nullptr; timer = overflow.next(timer))
+            {
+                if(timer->m_expires_tick / WHEEL_SLOTS == next_turn && timer->m_expires_tick < next_tick)
+                {
+                    next_tick = timer->m_expires_tick;
+                }
+            }
+
+            if(next_tick != ~0UL)
+            {
+                break;
+            }
+        }
+
+        return next_tick;
+    }
+
+    unsigned long tickAt(std::chrono::steady_clock::time_point time_point, bool is_round_up) const
+    {
+        if(time_point <= m_start)
+        {
+            return 0;
+        }
+
+        unsigned long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(time_point - m_start).count();
+        unsigned long tick = milliseconds / TICK_MILLISECONDS;
+
+        if(is_round_up && milliseconds % TICK_MILLISECONDS != 0)
+        {
+            ++tick;
+        }
+
+        return tick;
+    }
+
+    std::vector<IntrusiveList<TimerEntry>> m_slots;
+    std::vector<IntrusiveList<TimerEntry>> m_overflow_slots;
+    std::chrono::steady_clock::time_point  m_start;
+    unsigned long                          m_current_tick;
+    unsigned long                          m_size;
+
+    // Lower bound of the next tick with a timer, cancelled timers can make it early.
+    mutable unsigned long                  m_next_tick;
+    mutable bool                           m_is_next_tick_valid;
+};
+
+#endif // TIMER_WHEEL_HPP
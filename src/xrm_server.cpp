@@ -31,6 +31,8 @@
 #include "common_io.hpp"
 #include "encoding.hpp"
 #include "logging.hpp"
+#include "regex_validator.hpp"
+#include "screen_cache.hpp"
 
 #include <memory>
 #include <cstdlib>
@@ -135,6 +137,30 @@ auto main() -> int
         // All Good, Attached to Global Communicator Instance.
         TheCommunicator::instance()->attachConfiguration(config);
         Logging::instance()->xrmLog<Logging::CONSOLE_LOG>("Starting up Oblivion/2 XRM-Server");
+
+        // Screens are shared between nodes up to the configured memory.
+        ScreenCache::instance()->setMemoryLimit(
+            (config->screen_cache_kb > 0) ? config->screen_cache_kb * 1024 : 0);
+
+        // Compile the Validation Expressions once, shared by all sessions.
+        const std::string validations[] =
+        {
+            config->regexp_generic_validation,
+            config->regexp_handle_validation,
+            config->regexp_password_validation,
+            config->regexp_date_validation,
+            config->regexp_email_validation
+        };
+
+        for(const std::string &expression : validations)
+        {
+            std::string error = "";
+
+            if(!RegexValidator::getExpression(expression, error) && !error.empty())
+            {
+                Logging::instance()->xrmLog<Logging::ERROR_LOG>("Invalid Validation Expression=", expression, "Exception=", error);
+            }
+        }
     }
 
     // Initial Config File Read, and Start ASIO Server.
@@ -199,8 +225,10 @@ auto main() -> int
         // Create Handles to Services, and starts up connection listener and ASIO Thread Worker
         config_ptr config = TheCommunicator::instance()->getConfiguration();
 
-        IOService io_service;
-        interface_ptr setupAndRunAsioServer(new Interface(io_service, "TELNET", config->port_telnet));
+        IOServicePool io_service_pool(config->io_service_threads);
+        io_service_pool.setOutputLimits(config->output_high_water_mark, config->output_drop_limit);
+        io_service_pool.setCompression(config->mccp_compression_level, config->mccp_memory_limit_kb);
+        interface_ptr setupAndRunAsioServer(new Interface(io_service_pool, "TELNET", config->port_telnet));
 
 
         while(TheCommunicator::instance()->isActive())
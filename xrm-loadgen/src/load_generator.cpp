@@ -0,0 +1,1167 @@
+/*
+ * Oblivion/2 XRM - Load Generator (c) 2015-2019 Michael Griffin
+ * Opens a swarm of scripted telnet callers against a running server
+ * And reports connect, echo latency and throughput percentiles.
+ *
+ * Compiles under g++ / clang (POSIX Sockets)
+ *
+ * LIBS: yamlc++
+ *
+ */
+
+#include "telnet.hpp"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+typedef std::chrono::steady_clock::time_point time_point_t;
+
+/**
+ * @brief Microseconds between two points.
+ */
+static long elapsedMicroseconds(time_point_t start, time_point_t end)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+/**
+ * @class ScriptStep
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file load_generator.cpp
+ * @brief Single Step a caller walks, wait for output then send keys.
+ *        An empty expect waits until the screen goes idle.
+ */
+struct ScriptStep
+{
+    ScriptStep()
+        : m_expect("")
+        , m_send("")
+        , m_is_typed(false)
+        , m_think_ms(-1)
+    { }
+
+    ScriptStep(const std::string &expect, const std::string &send, bool is_typed)
+        : m_expect(expect)
+        , m_send(send)
+        , m_is_typed(is_typed)
+        , m_think_ms(-1)
+    { }
+
+    std::string m_expect;
+    std::string m_send;
+    bool        m_is_typed;  // Sent a key at a time, each echo is timed.
+    int         m_think_ms;  // -1 uses the global think-time.
+};
+
+/**
+ * @class LoadConfig
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file load_generator.cpp
+ * @brief Command line and script settings for the run.
+ */
+struct LoadConfig
+{
+    LoadConfig()
+        : m_host("127.0.0.1")
+        , m_port(6023)
+        , m_callers(10)
+        , m_ramp_ms(10)
+        , m_think_ms(150)
+        , m_idle_ms(400)
+        , m_step_timeout_ms(15000)
+        , m_duration_seconds(60)
+        , m_user("loadgen")
+        , m_password("loadgen")
+        , m_report_file("loadgen_report.yaml")
+        , m_loop_from(-1)
+        , m_steps()
+    { }
+
+    std::string             m_host;
+    int                     m_port;
+    int                     m_callers;
+    int                     m_ramp_ms;
+    int                     m_think_ms;
+    int                     m_idle_ms;
+    int                     m_step_timeout_ms;
+    int                     m_duration_seconds;
+    std::string             m_user;
+    std::string             m_password;
+    std::string             m_report_file;
+    int                     m_loop_from;  // Step to repeat from once the script ends, -1 hangs up.
+    std::vector<ScriptStep> m_steps;
+};
+
+/**
+ * @class LoadCaller
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file load_generator.cpp
+ * @brief A single scripted Telnet Caller, Non-Blocking and driven by the poll loop.
+ *        Answers option negotiation (TTYPE / NAWS) and ESC[6n detection.
+ */
+class LoadCaller
+{
+public:
+
+    enum
+    {
+        CALLER_WAITING,
+        CALLER_CONNECTING,
+        CALLER_RUNNING,
+        CALLER_DONE,
+        CALLER_FAILED
+    };
+
+    enum
+    {
+        TELNET_DATA,
+        TELNET_IAC,
+        TELNET_OPTION,
+        TELNET_SB,
+        TELNET_SB_IAC
+    };
+
+    LoadCaller(const LoadConfig &config, int node, time_point_t start_time)
+        : m_node(node)
+        , m_state(CALLER_WAITING)
+        , m_socket_id(-1)
+        , m_start_time(start_time)
+        , m_connect_time(start_time)
+        , m_last_recv_time(start_time)
+        , m_disconnect_time(start_time)
+        , m_bytes_received(0)
+        , m_bytes_sent(0)
+        , m_first_screen_us(-1)
+        , m_echo_us()
+        , m_failure("")
+        , m_config(config)
+        , m_next_action_time(start_time)
+        , m_step_start_time(start_time)
+        , m_echo_sent_time(start_time)
+        , m_is_echo_pending(false)
+        , m_is_first_screen(false)
+        , m_step_index(0)
+        , m_send_index(0)
+        , m_screen("")
+        , m_output("")
+        , m_telnet_state(TELNET_DATA)
+        , m_telnet_command(0)
+        , m_subnegotiation()
+        , m_escape("")
+    { }
+
+    ~LoadCaller()
+    {
+        disconnect();
+    }
+
+    /**
+     * @brief Start a Non-Blocking connect.
+     * @param address
+     * @param now
+     */
+    void connect(const struct addrinfo *address, time_point_t now)
+    {
+        m_connect_time = now;
+        m_socket_id = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+
+        if(m_socket_id == -1)
+        {
+            fail(std::string("socket: ") + strerror(errno));
+            return;
+        }
+
+        fcntl(m_socket_id, F_SETFL, fcntl(m_socket_id, F_GETFL, 0) | O_NONBLOCK);
+
+        int yes = 1;
+        setsockopt(m_socket_id, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        if(::connect(m_socket_id, address->ai_addr, address->ai_addrlen) == -1 && errno != EINPROGRESS)
+        {
+            fail(std::string("connect: ") + strerror(errno));
+            return;
+        }
+
+        m_state = CALLER_CONNECTING;
+    }
+
+    /**
+     * @brief Events to poll for, writes are only watched while connecting or backed up.
+     * @return
+     */
+    short pollEvents() const
+    {
+        if(m_state == CALLER_CONNECTING || !m_output.empty())
+        {
+            return POLLIN | POLLOUT;
+        }
+
+        return POLLIN;
+    }
+
+    /**
+     * @brief Handle poll() results for this caller.
+     * @param revents
+     * @param now
+     */
+    void onPoll(short revents, time_point_t now)
+    {
+        if(m_state == CALLER_CONNECTING && (revents & (POLLOUT | POLLERR | POLLHUP)))
+        {
+            int error = 0;
+            socklen_t length = sizeof(error);
+            getsockopt(m_socket_id, SOL_SOCKET, SO_ERROR, &error, &length);
+
+            if(error != 0)
+            {
+                fail(std::string("connect: ") + strerror(error));
+                return;
+            }
+
+            m_state = CALLER_RUNNING;
+            m_last_recv_time = now;
+            m_step_start_time = now;
+        }
+
+        if(m_state != CALLER_RUNNING)
+        {
+            return;
+        }
+
+        if(revents & (POLLIN | POLLHUP | POLLERR))
+        {
+            readSocket(now);
+        }
+
+        if(m_state == CALLER_RUNNING && (revents & POLLOUT))
+        {
+            flushOutput();
+        }
+    }
+
+    /**
+     * @brief Walk the script, called each pass of the loop.
+     * @param now
+     */
+    void process(time_point_t now)
+    {
+        if(m_state != CALLER_RUNNING || now < m_next_action_time)
+        {
+            return;
+        }
+
+        if(m_step_index >= m_config.m_steps.size())
+        {
+            if(m_config.m_loop_from < 0 || m_config.m_loop_from >= (int)m_config.m_steps.size())
+            {
+                hangup();
+                return;
+            }
+
+            m_step_index = m_config.m_loop_from;
+        }
+
+        const ScriptStep &step = m_config.m_steps[m_step_index];
+
+        // Still sending keys from this step, wait for the last echo first.
+        if(m_send_index > 0)
+        {
+            if(m_is_echo_pending)
+            {
+                checkStepTimeout(now);
+                return;
+            }
+
+            sendNextKey(step, now);
+            return;
+        }
+
+        bool is_ready = step.m_expect.empty()
+                        ? (elapsedMicroseconds(m_last_recv_time, now) >= m_config.m_idle_ms * 1000L)
+                        : (m_screen.find(step.m_expect) != std::string::npos);
+
+        if(!is_ready)
+        {
+            checkStepTimeout(now);
+            return;
+        }
+
+        m_screen.clear();
+
+        if(step.m_send.empty())
+        {
+            nextStep(now);
+            return;
+        }
+
+        if(!step.m_is_typed)
+        {
+            queueOutput(step.m_send);
+            nextStep(now);
+            return;
+        }
+
+        sendNextKey(step, now);
+    }
+
+    /**
+     * @brief Earliest time process() has something to do, used for the poll timeout.
+     * @return
+     */
+    time_point_t nextActionTime() const
+    {
+        return m_next_action_time;
+    }
+
+    /**
+     * @brief Close the connection, callers still running are counted as completed.
+     */
+    void hangup()
+    {
+        if(m_state == CALLER_RUNNING)
+        {
+            m_state = CALLER_DONE;
+        }
+
+        disconnect();
+    }
+
+    bool isActive() const
+    {
+        return m_state == CALLER_CONNECTING || m_state == CALLER_RUNNING;
+    }
+
+    int                       m_node;
+    int                       m_state;
+    int                       m_socket_id;
+    time_point_t              m_start_time;
+    time_point_t              m_connect_time;
+    time_point_t              m_last_recv_time;
+    time_point_t              m_disconnect_time;
+
+    unsigned long             m_bytes_received;
+    unsigned long             m_bytes_sent;
+    long                      m_first_screen_us;
+    std::vector<long>         m_echo_us;
+    std::string               m_failure;
+
+private:
+
+    const LoadConfig         &m_config;
+    time_point_t              m_next_action_time;
+    time_point_t              m_step_start_time;
+    time_point_t              m_echo_sent_time;
+    bool                      m_is_echo_pending;
+    bool                      m_is_first_screen;
+    unsigned int              m_step_index;
+    unsigned int              m_send_index;
+    std::string               m_screen;
+    std::string               m_output;
+    int                       m_telnet_state;
+    unsigned char             m_telnet_command;
+    std::vector<unsigned char> m_subnegotiation;
+    std::string               m_escape;
+
+    void disconnect()
+    {
+        if(m_socket_id != -1)
+        {
+            close(m_socket_id);
+            m_socket_id = -1;
+            m_disconnect_time = std::chrono::steady_clock::now();
+        }
+    }
+
+    void fail(const std::string &reason)
+    {
+        m_failure = reason;
+        m_state = CALLER_FAILED;
+        disconnect();
+    }
+
+    void checkStepTimeout(time_point_t now)
+    {
+        if(elapsedMicroseconds(m_step_start_time, now) > m_config.m_step_timeout_ms * 1000L)
+        {
+            fail("timeout on step " + std::to_string(m_step_index));
+        }
+    }
+
+    void nextStep(time_point_t now)
+    {
+        ++m_step_index;
+        m_send_index = 0;
+        m_step_start_time = now;
+        m_next_action_time = now;
+    }
+
+    /**
+     * @brief Think-Time with +/- 50% jitter so callers don't move in lock step.
+     * @param step
+     * @return
+     */
+    std::chrono::milliseconds thinkTime(const ScriptStep &step)
+    {
+        static std::mt19937 generator(std::random_device {}());
+        int think_ms = (step.m_think_ms >= 0) ? step.m_think_ms : m_config.m_think_ms;
+
+        if(think_ms <= 0)
+        {
+            return std::chrono::milliseconds(0);
+        }
+
+        std::uniform_int_distribution<int> jitter(think_ms / 2, think_ms + think_ms / 2);
+        return std::chrono::milliseconds(jitter(generator));
+    }
+
+    /**
+     * @brief Types one key of a step and starts timing it's echo.
+     * @param step
+     * @param now
+     */
+    void sendNextKey(const ScriptStep &step, time_point_t now)
+    {
+        if(m_send_index >= step.m_send.size())
+        {
+            nextStep(now);
+            return;
+        }
+
+        queueOutput(step.m_send.substr(m_send_index, 1));
+        ++m_send_index;
+        m_echo_sent_time = now;
+        m_is_echo_pending = true;
+        m_step_start_time = now;
+        m_next_action_time = now + thinkTime(step);
+    }
+
+    void queueOutput(const std::string &data)
+    {
+        m_output += data;
+        flushOutput();
+    }
+
+    void flushOutput()
+    {
+        while(!m_output.empty())
+        {
+            ssize_t result = send(m_socket_id, m_output.data(), m_output.size(), MSG_NOSIGNAL);
+
+            if(result < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+
+                if(errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    fail(std::string("send: ") + strerror(errno));
+                }
+
+                return;
+            }
+
+            m_bytes_sent += result;
+            m_output.erase(0, result);
+        }
+    }
+
+    void readSocket(time_point_t now)
+    {
+        unsigned char buffer[16384];
+
+        while(m_state == CALLER_RUNNING)
+        {
+            ssize_t result = recv(m_socket_id, buffer, sizeof(buffer), 0);
+
+            if(result < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+
+                if(errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    fail(std::string("recv: ") + strerror(errno));
+                }
+
+                return;
+            }
+
+            if(result == 0)
+            {
+                // Server hung up on us, fine once the script has run through.
+                if(m_step_index >= m_config.m_steps.size() || m_config.m_loop_from >= 0)
+                {
+                    hangup();
+                }
+                else
+                {
+                    fail("disconnected on step " + std::to_string(m_step_index));
+                }
+
+                return;
+            }
+
+            m_bytes_received += result;
+            m_last_recv_time = now;
+            parseTelnet(buffer, result, now);
+        }
+    }
+
+    /**
+     * @brief Strip Telnet Commands, answer them, and keep the text for matching.
+     * @param buffer
+     * @param length
+     * @param now
+     */
+    void parseTelnet(const unsigned char *buffer, ssize_t length, time_point_t now)
+    {
+        std::string text;
+
+        for(ssize_t i = 0; i < length; i++)
+        {
+            unsigned char c = buffer[i];
+
+            switch(m_telnet_state)
+            {
+                case TELNET_DATA:
+                    if(c == IAC)
+                    {
+                        m_telnet_state = TELNET_IAC;
+                    }
+                    else
+                    {
+                        text += c;
+                    }
+
+                    break;
+
+                case TELNET_IAC:
+                    if(c == IAC)
+                    {
+                        text += c;
+                        m_telnet_state = TELNET_DATA;
+                    }
+                    else if(c == DO || c == DONT || c == WILL || c == WONT)
+                    {
+                        m_telnet_command = c;
+                        m_telnet_state = TELNET_OPTION;
+                    }
+                    else if(c == SB)
+                    {
+                        m_subnegotiation.clear();
+                        m_telnet_state = TELNET_SB;
+                    }
+                    else
+                    {
+                        m_telnet_state = TELNET_DATA;
+                    }
+
+                    break;
+
+                case TELNET_OPTION:
+                    answerOption(m_telnet_command, c);
+                    m_telnet_state = TELNET_DATA;
+                    break;
+
+                case TELNET_SB:
+                    if(c == IAC)
+                    {
+                        m_telnet_state = TELNET_SB_IAC;
+                    }
+                    else
+                    {
+                        m_subnegotiation.push_back(c);
+                    }
+
+                    break;
+
+                case TELNET_SB_IAC:
+                    if(c == SE)
+                    {
+                        answerSubnegotiation();
+                        m_telnet_state = TELNET_DATA;
+                    }
+                    else
+                    {
+                        m_subnegotiation.push_back(c);
+                        m_telnet_state = TELNET_SB;
+                    }
+
+                    break;
+            }
+        }
+
+        if(text.empty())
+        {
+            return;
+        }
+
+        if(!m_is_first_screen)
+        {
+            m_is_first_screen = true;
+            m_first_screen_us = elapsedMicroseconds(m_connect_time, now);
+        }
+
+        if(m_is_echo_pending)
+        {
+            m_is_echo_pending = false;
+            m_echo_us.push_back(elapsedMicroseconds(m_echo_sent_time, now));
+        }
+
+        answerCursorPosition(text);
+
+        // Only the recent screen is kept for matching.
+        m_screen += text;
+
+        if(m_screen.size() > 8192)
+        {
+            m_screen.erase(0, m_screen.size() - 8192);
+        }
+    }
+
+    /**
+     * @brief Agree to the options a Terminal would, refuse the rest.
+     * @param command
+     * @param option
+     */
+    void answerOption(unsigned char command, unsigned char option)
+    {
+        std::string reply;
+
+        if(command == DO)
+        {
+            bool is_supported = (option == TELOPT_TTYPE || option == TELOPT_NAWS ||
+                                 option == TELOPT_BINARY || option == TELOPT_SGA);
+
+            reply = { (char)IAC, (char)(is_supported ? WILL : WONT), (char)option };
+
+            if(option == TELOPT_NAWS)
+            {
+                reply += { (char)IAC, (char)SB, (char)TELOPT_NAWS, 0, 80, 0, 24, (char)IAC, (char)SE };
+            }
+        }
+        else if(command == WILL)
+        {
+            bool is_supported = (option == TELOPT_ECHO || option == TELOPT_SGA || option == TELOPT_BINARY);
+            reply = { (char)IAC, (char)(is_supported ? DO : DONT), (char)option };
+        }
+
+        if(!reply.empty())
+        {
+            queueOutput(reply);
+        }
+    }
+
+    void answerSubnegotiation()
+    {
+        if(m_subnegotiation.size() >= 2 &&
+                m_subnegotiation[0] == TELOPT_TTYPE && m_subnegotiation[1] == TELQUAL_SEND)
+        {
+            std::string reply = { (char)IAC, (char)SB, (char)TELOPT_TTYPE, (char)TELQUAL_IS };
+            reply += "ANSI";
+            reply += { (char)IAC, (char)SE };
+            queueOutput(reply);
+        }
+    }
+
+    /**
+     * @brief Answer ESC[6n Terminal Detection, can be split across reads.
+     * @param text
+     */
+    void answerCursorPosition(const std::string &text)
+    {
+        m_escape += text;
+        std::string::size_type position;
+
+        while((position = m_escape.find("\x1b[6n")) != std::string::npos)
+        {
+            queueOutput("\x1b[24;80R");
+            m_escape.erase(0, position + 4);
+        }
+
+        if(m_escape.size() > 3)
+        {
+            m_escape.erase(0, m_escape.size() - 3);
+        }
+    }
+};
+
+typedef std::shared_ptr<LoadCaller> load_caller_ptr;
+
+/**
+ * @class LoadGenerator
+ * @author Michael Griffin
+ * @date 18/10/2026
+ * @file load_generator.cpp
+ * @brief Runs the Callers in a single poll() loop and writes the report.
+ */
+class LoadGenerator
+{
+public:
+
+    explicit LoadGenerator(const LoadConfig &config)
+        : m_config(config)
+        , m_callers()
+        , m_start_time()
+        , m_end_time()
+    { }
+
+    /**
+     * @brief Ramp up the callers and run until they finish or the duration ends.
+     * @return
+     */
+    bool run()
+    {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        struct addrinfo *address = nullptr;
+        std::string port = std::to_string(m_config.m_port);
+
+        if(getaddrinfo(m_config.m_host.c_str(), port.c_str(), &hints, &address) != 0 || address == nullptr)
+        {
+            std::cout << "Unable to resolve: " << m_config.m_host << std::endl;
+            return false;
+        }
+
+        m_start_time = std::chrono::steady_clock::now();
+        time_point_t stop_time = m_start_time + std::chrono::seconds(m_config.m_duration_seconds);
+
+        for(int i = 0; i < m_config.m_callers; i++)
+        {
+            m_callers.push_back(load_caller_ptr(new LoadCaller(m_config, i + 1, m_start_time)));
+        }
+
+        int next_caller = 0;
+        std::vector<struct pollfd> poll_list;
+        std::vector<load_caller_ptr> polled_callers;
+
+        while(true)
+        {
+            time_point_t now = std::chrono::steady_clock::now();
+
+            // Ramp up, one caller every ramp_ms.
+            while(next_caller < m_config.m_callers &&
+                    elapsedMicroseconds(m_start_time, now) >= (long)next_caller * m_config.m_ramp_ms * 1000L)
+            {
+                m_callers[next_caller++]->connect(address, now);
+            }
+
+            if(now >= stop_time)
+            {
+                break;
+            }
+
+            poll_list.clear();
+            polled_callers.clear();
+            // Callers waiting on an idle screen are checked every pass, so keep it short.
+            time_point_t wake_time = now + std::chrono::milliseconds(10);
+
+            for(auto &caller : m_callers)
+            {
+                if(!caller->isActive())
+                {
+                    continue;
+                }
+
+                struct pollfd descriptor;
+                descriptor.fd = caller->m_socket_id;
+                descriptor.events = caller->pollEvents();
+                descriptor.revents = 0;
+                poll_list.push_back(descriptor);
+                polled_callers.push_back(caller);
+
+                if(caller->nextActionTime() > now && caller->nextActionTime() < wake_time)
+                {
+                    wake_time = caller->nextActionTime();
+                }
+            }
+
+            if(poll_list.empty() && next_caller >= m_config.m_callers)
+            {
+                break;
+            }
+
+            int timeout = (wake_time > now) ? (int)(elapsedMicroseconds(now, wake_time) / 1000) : 0;
+
+            if(poll(poll_list.data(), poll_list.size(), timeout) == -1 && errno != EINTR)
+            {
+                std::cout << "poll: " << strerror(errno) << std::endl;
+                break;
+            }
+
+            now = std::chrono::steady_clock::now();
+
+            for(unsigned int i = 0; i < poll_list.size(); i++)
+            {
+                if(poll_list[i].revents != 0)
+                {
+                    polled_callers[i]->onPoll(poll_list[i].revents, now);
+                }
+
+                polled_callers[i]->process(now);
+            }
+        }
+
+        for(auto &caller : m_callers)
+        {
+            caller->hangup();
+        }
+
+        m_end_time = std::chrono::steady_clock::now();
+        freeaddrinfo(address);
+        return true;
+    }
+
+    /**
+     * @brief Write the Percentiles to the YAML Report and a Summary to the Console.
+     * @return
+     */
+    bool writeReport()
+    {
+        std::vector<long> first_screen;
+        std::vector<long> echo;
+        std::vector<long> throughput;
+        unsigned long bytes_received = 0;
+        unsigned long bytes_sent = 0;
+        int completed = 0;
+        int failed = 0;
+
+        for(auto &caller : m_callers)
+        {
+            if(caller->m_state == LoadCaller::CALLER_FAILED)
+            {
+                ++failed;
+            }
+            else if(caller->m_state == LoadCaller::CALLER_DONE)
+            {
+                ++completed;
+            }
+
+            if(caller->m_first_screen_us >= 0)
+            {
+                first_screen.push_back(caller->m_first_screen_us);
+            }
+
+            echo.insert(echo.end(), caller->m_echo_us.begin(), caller->m_echo_us.end());
+            bytes_received += caller->m_bytes_received;
+            bytes_sent += caller->m_bytes_sent;
+
+            long session_us = elapsedMicroseconds(caller->m_connect_time, caller->m_disconnect_time);
+
+            if(caller->m_bytes_received > 0 && session_us > 0)
+            {
+                throughput.push_back((long)(caller->m_bytes_received * 1000000.0 / session_us));
+            }
+        }
+
+        double run_seconds = elapsedMicroseconds(m_start_time, m_end_time) / 1000000.0;
+
+        YAML::Emitter out;
+        out.SetDoublePrecision(6);
+        out << YAML::BeginMap;
+        out << YAML::Key << "host" << YAML::Value << m_config.m_host;
+        out << YAML::Key << "port" << YAML::Value << m_config.m_port;
+        out << YAML::Key << "callers" << YAML::Value << m_config.m_callers;
+        out << YAML::Key << "completed" << YAML::Value << completed;
+        out << YAML::Key << "failed" << YAML::Value << failed;
+        out << YAML::Key << "run_seconds" << YAML::Value << run_seconds;
+        out << YAML::Key << "think_ms" << YAML::Value << m_config.m_think_ms;
+        out << YAML::Key << "bytes_received" << YAML::Value << bytes_received;
+        out << YAML::Key << "bytes_sent" << YAML::Value << bytes_sent;
+        out << YAML::Key << "total_bytes_per_second" << YAML::Value
+            << (run_seconds > 0 ? (unsigned long)(bytes_received / run_seconds) : 0);
+
+        emitPercentiles(out, "first_screen_ms", first_screen, 1000.0);
+        emitPercentiles(out, "echo_ms", echo, 1000.0);
+        emitPercentiles(out, "caller_bytes_per_second", throughput, 1.0);
+
+        // Keep the first few failures, enough to see why without flooding the report.
+        out << YAML::Key << "failures" << YAML::Value << YAML::BeginSeq;
+        int listed = 0;
+
+        for(auto &caller : m_callers)
+        {
+            if(caller->m_state == LoadCaller::CALLER_FAILED && listed++ < 20)
+            {
+                out << ("node " + std::to_string(caller->m_node) + ": " + caller->m_failure);
+            }
+        }
+
+        out << YAML::EndSeq;
+        out << YAML::EndMap;
+
+        std::ofstream ofs(m_config.m_report_file);
+
+        if(!ofs.is_open())
+        {
+            std::cout << "Unable to write report: " << m_config.m_report_file << std::endl;
+            return false;
+        }
+
+        ofs << out.c_str() << std::endl;
+        ofs.close();
+
+        std::cout << out.c_str() << std::endl << std::endl;
+        std::cout << "Report written: " << m_config.m_report_file << std::endl;
+        return true;
+    }
+
+private:
+
+    const LoadConfig            &m_config;
+    std::vector<load_caller_ptr> m_callers;
+    time_point_t                 m_start_time;
+    time_point_t                 m_end_time;
+
+    /**
+     * @brief Nearest Rank Percentile, samples must be sorted.
+     */
+    static long percentile(const std::vector<long> &samples, double percent)
+    {
+        if(samples.empty())
+        {
+            return 0;
+        }
+
+        // Smallest rank covering the percent, ceil(P / 100 * N) clamped to [1, N].
+        unsigned long rank = (unsigned long)std::ceil(percent / 100.0 * samples.size());
+
+        if(rank < 1)
+        {
+            rank = 1;
+        }
+
+        if(rank > samples.size())
+        {
+            rank = samples.size();
+        }
+
+        return samples[rank - 1];
+    }
+
+    static void emitPercentiles(YAML::Emitter &out, const std::string &name, std::vector<long> samples, double divisor)
+    {
+        std::sort(samples.begin(), samples.end());
+
+        out << YAML::Key << name << YAML::Value << YAML::BeginMap;
+        out << YAML::Key << "samples" << YAML::Value << samples.size();
+        out << YAML::Key << "p50" << YAML::Value << percentile(samples, 50) / divisor;
+        out << YAML::Key << "p90" << YAML::Value << percentile(samples, 90) / divisor;
+        out << YAML::Key << "p95" << YAML::Value << percentile(samples, 95) / divisor;
+        out << YAML::Key << "p99" << YAML::Value << percentile(samples, 99) / divisor;
+        out << YAML::Key << "max" << YAML::Value << (samples.empty() ? 0 : samples.back() / divisor);
+        out << YAML::EndMap;
+    }
+};
+
+/**
+ * @brief Default walk, Prelogon (ANSI / Codepage), Logon then Menu keys.
+ *        Prompts are themeable, so each step waits for the screen to go idle.
+ * @param config
+ */
+static void defaultScript(LoadConfig &config)
+{
+    config.m_steps.push_back(ScriptStep("", "y", true));
+    config.m_steps.push_back(ScriptStep("", "y", true));
+    config.m_steps.push_back(ScriptStep("", config.m_user + "\r", true));
+    config.m_steps.push_back(ScriptStep("", config.m_password + "\r", true));
+    config.m_steps.push_back(ScriptStep("", "\r", true));
+
+    // Menu loop, repeats until the duration ends.
+    config.m_loop_from = config.m_steps.size();
+    config.m_steps.push_back(ScriptStep("", "?", true));
+    config.m_steps.push_back(ScriptStep("", "\r", true));
+}
+
+/**
+ * @brief Load Script Steps from a YAML File.
+ *
+ *   loop_from: 2
+ *   steps:
+ *     - expect: "Use ANSI"
+ *       type: "y"
+ *     - send: "\r"
+ *       think_ms: 500
+ *
+ * @param config
+ * @param path
+ * @return
+ */
+static bool loadScript(LoadConfig &config, const std::string &path)
+{
+    try
+    {
+        YAML::Node node = YAML::LoadFile(path);
+
+        if(node["loop_from"])
+        {
+            config.m_loop_from = node["loop_from"].as<int>();
+        }
+
+        for(auto step_node : node["steps"])
+        {
+            ScriptStep step;
+
+            if(step_node["expect"])
+            {
+                step.m_expect = step_node["expect"].as<std::string>();
+            }
+
+            if(step_node["type"])
+            {
+                step.m_send = step_node["type"].as<std::string>();
+                step.m_is_typed = true;
+            }
+            else if(step_node["send"])
+            {
+                step.m_send = step_node["send"].as<std::string>();
+            }
+
+            if(step_node["think_ms"])
+            {
+                step.m_think_ms = step_node["think_ms"].as<int>();
+            }
+
+            config.m_steps.push_back(step);
+        }
+    }
+    catch(std::exception &e)
+    {
+        std::cout << "Unable to load script: " << path << std::endl;
+        std::cout << e.what() << std::endl;
+        return false;
+    }
+
+    return !config.m_steps.empty();
+}
+
+static void usage()
+{
+    std::cout << "usage: xrm-loadgen [options]" << std::endl
+              << "  -h host       Server host (127.0.0.1)" << std::endl
+              << "  -p port       Telnet port (6023)" << std::endl
+              << "  -n callers    Number of callers (10)" << std::endl
+              << "  -r ms         Ramp up, delay between new callers (10)" << std::endl
+              << "  -t ms         Keystroke think-time (150)" << std::endl
+              << "  -i ms         Idle time before answering a screen (400)" << std::endl
+              << "  -d seconds    Run duration (60)" << std::endl
+              << "  -u user       Logon user name (loadgen)" << std::endl
+              << "  -w password   Logon password (loadgen)" << std::endl
+              << "  -s script     YAML script of steps, default walks prelogon, logon and menus" << std::endl
+              << "  -o file       Report file (loadgen_report.yaml)" << std::endl;
+}
+
+#endif // _WIN32
+
+auto main(int argc, char *argv[]) -> int
+{
+    std::cout << "Oblivion/2 XRM Server - Load Generator" << std::endl;
+    std::cout << "(c) 2015-2019 Michael Griffin." << std::endl << std::endl;
+
+#ifdef _WIN32
+    std::cout << "xrm-loadgen requires POSIX sockets, not available on Windows." << std::endl;
+    return 1;
+#else
+
+    LoadConfig config;
+    std::string script_file = "";
+    int option;
+
+    while((option = getopt(argc, argv, "h:p:n:r:t:i:d:u:w:s:o:")) != -1)
+    {
+        switch(option)
+        {
+            case 'h': config.m_host = optarg; break;
+            case 'p': config.m_port = atoi(optarg); break;
+            case 'n': config.m_callers = atoi(optarg); break;
+            case 'r': config.m_ramp_ms = atoi(optarg); break;
+            case 't': config.m_think_ms = atoi(optarg); break;
+            case 'i': config.m_idle_ms = atoi(optarg); break;
+            case 'd': config.m_duration_seconds = atoi(optarg); break;
+            case 'u': config.m_user = optarg; break;
+            case 'w': config.m_password = optarg; break;
+            case 's': script_file = optarg; break;
+            case 'o': config.m_report_file = optarg; break;
+
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    if(config.m_callers <= 0 || config.m_port <= 0)
+    {
+        usage();
+        return 1;
+    }
+
+    if(script_file.empty())
+    {
+        defaultScript(config);
+    }
+    else if(!loadScript(config, script_file))
+    {
+        return 1;
+    }
+
+    // Each caller is a descriptor, raise the soft limit as far as allowed.
+    struct rlimit limit;
+
+    if(getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    std::cout << "Callers: " << config.m_callers << " -> " << config.m_host << ":" << config.m_port
+              << " for " << config.m_duration_seconds << " seconds." << std::endl;
+
+    LoadGenerator load_generator(config);
+
+    if(!load_generator.run())
+    {
+        return 1;
+    }
+
+    return load_generator.writeReport() ? 0 : 1;
+#endif
+}
@@ -39,11 +39,75 @@ SUITE(XRMAnsiProcessor)
     {
         AnsiProcessor ansi(25,80);
         ansi.parseAnsiScreen((char *)"ABC1234");
-        CHECK(ansi.m_screen_buffer[0].char_sequence == "A");
-        CHECK(ansi.m_screen_buffer[6].char_sequence == "4");
+        CHECK(ansi.m_screen_buffer[0].code_point == 'A');
+        CHECK(ansi.m_screen_buffer[6].code_point == '4');
 
     }
 
+    TEST(parseAnsi_Unicode_Glyph_Stored_As_Code_Point)
+    {
+        AnsiProcessor ansi(25,80);
+        ansi.parseAnsiScreen((char *)"A\xe2\x96\x91" "B");
+        CHECK(ansi.m_screen_buffer[1].code_point == 0x2591);
+        CHECK(ansi.screenBufferToString().substr(0, 5) == "A\xe2\x96\x91" "B");
+    }
+
+    TEST(parseAnsi_Scroll_Up_Moves_Lines_And_Clears_Last)
+    {
+        AnsiProcessor ansi(2,4);
+        ansi.parseAnsiScreen((char *)"ABCD\r\nEFGH\r\nIJ");
+        CHECK_EQUAL("EFGHIJ  ", ansi.screenBufferToString());
+    }
+
+    TEST(parseAnsi_Clear_Screen_Resets_Buffer)
+    {
+        AnsiProcessor ansi(2,4);
+        ansi.parseAnsiScreen((char *)"ABCD\x1b[2JX");
+        CHECK_EQUAL("X       ", ansi.screenBufferToString());
+        CHECK(ansi.m_screen_buffer[1].code_point == 0);
+        CHECK(ansi.m_screen_buffer[1].attribute == 0);
+    }
+
+    TEST(getScreenDifference_Nothing_Changed_Is_Empty)
+    {
+        AnsiProcessor ansi(5,10);
+        ansi.parseAnsiScreen((char *)"ABC\r\nDEF");
+        ansi.markScreenFlushed();
+        CHECK_EQUAL("", ansi.getScreenDifference());
+    }
+
+    TEST(getScreenDifference_Lightbar_Sends_Only_Changed_Cells)
+    {
+        AnsiProcessor ansi(5,10);
+        ansi.parseAnsiScreen((char *)"\x1b[0;37;40mMENU\r\n\x1b[2;3HOK");
+        ansi.markScreenFlushed();
+
+        // Same text, new colors on the bar.
+        ansi.parseAnsiScreen((char *)"\x1b[2;3H\x1b[0;30;47mOK\x1b[0m");
+        CHECK_EQUAL("\x1b[2;3H\x1b[0;30;47mOK\x1b[0m", ansi.getScreenDifference());
+        CHECK_EQUAL("", ansi.getScreenDifference());
+    }
+
+    TEST(getScreenDifference_Skips_Unchanged_Cells_On_A_Row)
+    {
+        AnsiProcessor ansi(5,10);
+        ansi.parseAnsiScreen((char *)"ABCDEFGH");
+        ansi.markScreenFlushed();
+
+        ansi.parseAnsiScreen((char *)"\x1b[1;2Hx\x1b[1;6Hy");
+        CHECK_EQUAL("\x1b[1;2H\x1b[0;37;40mx\x1b[3Cy\x1b[0m", ansi.getScreenDifference());
+    }
+
+    TEST(getScreenDifference_Clear_Screen_Is_Sent_Once)
+    {
+        AnsiProcessor ansi(5,10);
+        ansi.parseAnsiScreen((char *)"ABCDEFGH");
+        ansi.markScreenFlushed();
+
+        ansi.parseAnsiScreen((char *)"\x1b[2JZ");
+        CHECK_EQUAL("\x1b[1;1H\x1b[2J\x1b[0;37;40mZ\x1b[0m", ansi.getScreenDifference());
+    }
+
     // Test the Program Path is being read correctly.
     TEST(parseAnsi_Test_Line_Wraping)
     {
@@ -4,6 +4,7 @@
  */
 
 #include "common_io.hpp"
+#include "screen_cache.hpp"
 
 #include <UnitTest++.h>
 
@@ -11,6 +12,9 @@
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <cstdio>
+#include <chrono>
+#include <thread>
 
 /**
  * @brief Test Suit for CommonIO Class.
@@ -462,4 +466,58 @@ SUITE(XRMCommonIO)
         CHECK_EQUAL(1, 1);
     }*/
 
+
+    TEST(ScreenCache_normalizeNewLines_Folds_Runs_To_CRLF)
+    {
+        CHECK_EQUAL("A\r\nB\r\nC\r\n", ScreenCache::normalizeNewLines("A\nB\r\r\n\nC\r"));
+        CHECK_EQUAL("ABC", ScreenCache::normalizeNewLines("ABC"));
+        CHECK_EQUAL("", ScreenCache::normalizeNewLines(""));
+    }
+
+    TEST(ScreenCache_getScreen_Reloads_When_File_Changes)
+    {
+        std::string path = "screen_cache_ut.ans";
+        FILE *fp = fopen(path.c_str(), "wb");
+        fputs("ONE\n", fp);
+        fclose(fp);
+
+        screen_buffer_ptr first = ScreenCache::instance()->getScreen(path);
+        CHECK(first != nullptr);
+        CHECK_EQUAL("ONE\r\n", *first);
+
+        // Same file is shared until it's changed.
+        CHECK(first == ScreenCache::instance()->getScreen(path));
+
+        fp = fopen(path.c_str(), "wb");
+        fputs("TWO2\n", fp);
+        fclose(fp);
+
+        CHECK_EQUAL("TWO2\r\n", *ScreenCache::instance()->getScreen(path));
+
+        std::remove(path.c_str());
+        CHECK(ScreenCache::instance()->getScreen(path) == nullptr);
+    }
+
+    TEST(ScreenCache_getScreen_Reloads_Same_Size_Change)
+    {
+        std::string path = "screen_cache_size_ut.ans";
+        FILE *fp = fopen(path.c_str(), "wb");
+        fputs("ONE\n", fp);
+        fclose(fp);
+
+        CHECK_EQUAL("ONE\r\n", *ScreenCache::instance()->getScreen(path));
+
+        // Same size and likely the same second, only the nanoseconds differ.
+        // File times are only updated each kernel tick, so wait out a few.
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        fp = fopen(path.c_str(), "wb");
+        fputs("TWO\n", fp);
+        fclose(fp);
+
+        CHECK_EQUAL("TWO\r\n", *ScreenCache::instance()->getScreen(path));
+
+        std::remove(path.c_str());
+    }
+
 }
@@ -0,0 +1,247 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for the Input Pipeline.
+ * @return
+ */
+
+#include "input_normalizer.hpp"
+#include "input_sequencer.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+
+/**
+ * @brief Test Suit for InputNormalizer Class.
+ * @return
+ */
+SUITE(XRMInputNormalizer)
+{
+
+    TEST(normalize_Text_Passed_Through)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        normalizer.normalize("testing", output, false);
+        CHECK_EQUAL(output, "testing");
+    }
+
+    TEST(normalize_CRLF_Folded_To_LF)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        normalizer.normalize("abc\r\ndef\r\n", output, false);
+        CHECK_EQUAL(output, "abc\ndef\n");
+    }
+
+    TEST(normalize_CRLF_Split_Between_Reads_Folded_To_LF)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        // The CR is passed on right away, the LF in the next read is dropped.
+        normalizer.normalize("abc\r", output, false);
+        CHECK_EQUAL(output, "abc\n");
+
+        normalizer.normalize("\ndef", output, false);
+        CHECK_EQUAL(output, "abc\ndef");
+    }
+
+    TEST(normalize_Split_And_Unsplit_CRLF_Are_The_Same)
+    {
+        InputNormalizer split;
+        InputNormalizer unsplit;
+        std::string split_output = "";
+        std::string unsplit_output = "";
+
+        split.normalize("\r", split_output, false);
+        split.normalize("\n", split_output, false);
+        unsplit.normalize("\r\n", unsplit_output, false);
+
+        CHECK_EQUAL(split_output, unsplit_output);
+        CHECK_EQUAL(split_output, "\n");
+    }
+
+    TEST(normalize_CRLF_Split_By_Telnet_Option_Only_Read)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        // ie.. a NAWS resize between the CR and LF, the decoded read is empty.
+        normalizer.normalize("abc\r", output, false);
+        normalizer.normalize("", output, false);
+        normalizer.normalize("\ndef", output, false);
+        CHECK_EQUAL(output, "abc\ndef");
+    }
+
+    TEST(normalize_Lone_CR_Folded_To_LF)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        normalizer.normalize("abc\rdef\r\r", output, false);
+        CHECK_EQUAL(output, "abc\ndef\n\n");
+    }
+
+    TEST(normalize_CR_Then_Text_In_Next_Read_Is_Kept)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        normalizer.normalize("\r", output, false);
+        normalizer.normalize("x\n", output, false);
+        CHECK_EQUAL(output, "\nx\n");
+    }
+
+    TEST(normalize_LF_Passed_Through)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        normalizer.normalize("abc\n\n", output, false);
+        CHECK_EQUAL(output, "abc\n\n");
+    }
+
+    TEST(normalize_CP437_Translated_To_UTF8)
+    {
+        InputNormalizer normalizer;
+        std::string output = "";
+
+        // Light Shade and Full Block around a CR\LF.
+        std::string input = "a";
+        input += static_cast<char>(0xb0);
+        input += "\r\n";
+        input += static_cast<char>(0xdb);
+        input += "\r";
+
+        normalizer.normalize(input, output, true);
+        CHECK_EQUAL(output, "a\xe2\x96\x91\n\xe2\x96\x88\n");
+
+        normalizer.normalize("\n", output, true);
+        CHECK_EQUAL(output, "a\xe2\x96\x91\n\xe2\x96\x88\n");
+    }
+
+}
+
+
+/**
+ * @brief Test Suit for InputSequencer Class.
+ * @return
+ */
+SUITE(XRMInputSequencer)
+{
+
+    TEST(resolve_Complete_Sequence_In_One_Packet)
+    {
+        InputSequencer sequencer;
+        std::string data = "a\x1b[Ab";
+
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "a\x1b[Ab");
+        CHECK_EQUAL(sequencer.isPending(), false);
+    }
+
+    TEST(resolve_Sequence_Split_Between_Packets)
+    {
+        InputSequencer sequencer;
+        std::string data = "ab\x1b[";
+
+        // The start of the sequence is held, the text before it is passed on.
+        CHECK_EQUAL(sequencer.resolve(data), true);
+        CHECK_EQUAL(data, "ab");
+        CHECK_EQUAL(sequencer.isPending(), true);
+
+        data = "1";
+        CHECK_EQUAL(sequencer.resolve(data), true);
+        CHECK_EQUAL(data, "");
+
+        data = "~c";
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "\x1b[1~c");
+        CHECK_EQUAL(sequencer.isPending(), false);
+    }
+
+    TEST(flush_Lone_ESC_After_Deadline)
+    {
+        InputSequencer sequencer;
+        std::string data = "\x1b";
+
+        CHECK_EQUAL(sequencer.resolve(data), true);
+        CHECK_EQUAL(data, "");
+
+        // ESC Deadline passed, nothing followed so it's the ESC key.
+        sequencer.flush(data);
+        CHECK_EQUAL(data, "\x1b");
+        CHECK_EQUAL(sequencer.isPending(), false);
+
+        // Starts over from ground.
+        data = "A";
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "A");
+    }
+
+    TEST(resolve_Alt_Key)
+    {
+        InputSequencer sequencer;
+        std::string data = "\x1bx";
+
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "\x1bx");
+    }
+
+    TEST(resolve_SS3_Sequence)
+    {
+        InputSequencer sequencer;
+        std::string data = "\x1bO";
+
+        CHECK_EQUAL(sequencer.resolve(data), true);
+
+        data = "P";
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "\x1bOP");
+    }
+
+    TEST(resolve_Linux_Console_Function_Key)
+    {
+        InputSequencer sequencer;
+        std::string data = "\x1b[[A";
+
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "\x1b[[A");
+
+        // Split after the second [
+        data = "\x1b[[";
+        CHECK_EQUAL(sequencer.resolve(data), true);
+        CHECK_EQUAL(data, "");
+
+        data = "B";
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, "\x1b[[B");
+    }
+
+    TEST(resolve_Sequence_Cut_Off_At_Max_Length)
+    {
+        InputSequencer sequencer;
+
+        // One short of the limit is still held for the rest.
+        std::string data = "\x1b[";
+        data.append(InputSequencer::MAX_SEQUENCE_LENGTH - 3, '1');
+        CHECK_EQUAL(sequencer.resolve(data), true);
+        CHECK_EQUAL(data, "");
+        sequencer.flush(data);
+
+        // At the limit it's not a sequence, passed on as is.
+        data = "\x1b[";
+        data.append(InputSequencer::MAX_SEQUENCE_LENGTH - 2, '1');
+        std::string expected = data;
+        CHECK_EQUAL(sequencer.resolve(data), false);
+        CHECK_EQUAL(data, expected);
+        CHECK_EQUAL(sequencer.isPending(), false);
+    }
+
+}
@@ -0,0 +1,366 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for the IOService Queue and Timers.
+ * @return
+ */
+
+#include "mpsc_queue.hpp"
+#include "timer_wheel.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+/**
+ * @brief Test Suit for MpscQueue Class.
+ * @return
+ */
+SUITE(XRMMpscQueue)
+{
+
+    TEST(pop_Empty_Queue)
+    {
+        MpscQueue<int> queue;
+        int item = 0;
+
+        CHECK(queue.isEmpty());
+        CHECK_EQUAL(queue.pop(item), false);
+    }
+
+    TEST(pop_Single_Producer_Keeps_Order)
+    {
+        MpscQueue<int> queue;
+
+        for(int i = 0; i < 100; i++)
+        {
+            queue.push(i);
+        }
+
+        CHECK_EQUAL(queue.isEmpty(), false);
+
+        int item = -1;
+
+        for(int i = 0; i < 100; i++)
+        {
+            CHECK(queue.pop(item));
+            CHECK_EQUAL(i, item);
+        }
+
+        CHECK(queue.isEmpty());
+        CHECK_EQUAL(queue.pop(item), false);
+    }
+
+    TEST(pop_Empty_Then_Refill)
+    {
+        MpscQueue<std::string> queue;
+        std::string item = "";
+
+        queue.push("one");
+        CHECK(queue.pop(item));
+        CHECK_EQUAL("one", item);
+        CHECK_EQUAL(queue.pop(item), false);
+
+        // The stub node is linked back in, the queue works after emptying.
+        queue.push("two");
+        queue.push("three");
+        CHECK(queue.pop(item));
+        CHECK_EQUAL("two", item);
+        CHECK(queue.pop(item));
+        CHECK_EQUAL("three", item);
+        CHECK(queue.isEmpty());
+    }
+
+    TEST(clear_Drops_All_Items)
+    {
+        MpscQueue<std::shared_ptr<int>> queue;
+        std::shared_ptr<int> value = std::make_shared<int>(1);
+
+        queue.push(value);
+        queue.push(value);
+        CHECK_EQUAL(3, value.use_count());
+
+        queue.clear();
+        CHECK(queue.isEmpty());
+        CHECK_EQUAL(1, value.use_count());
+    }
+
+    TEST(pop_Multiple_Producers_Each_Item_Once)
+    {
+        const int producers = 4;
+        const int items_per_producer = 10000;
+
+        MpscQueue<int> queue;
+        std::vector<std::thread> threads;
+
+        for(int p = 0; p < producers; p++)
+        {
+            threads.push_back(std::thread([&queue, p, items_per_producer]()
+            {
+                for(int i = 0; i < items_per_producer; i++)
+                {
+                    queue.push(p * items_per_producer + i);
+                }
+            }));
+        }
+
+        // Pop while producers are pushing, pop can miss an item mid link so keep trying.
+        std::vector<int> received(producers * items_per_producer, 0);
+        std::vector<int> last_from_producer(producers, -1);
+        bool is_in_order = true;
+        int count = 0;
+        int item = 0;
+        std::chrono::steady_clock::time_point give_up = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while(count < producers * items_per_producer && std::chrono::steady_clock::now() < give_up)
+        {
+            if(!queue.pop(item))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            ++received[item];
+            ++count;
+
+            // Each producer's own items still arrive in order.
+            int producer = item / items_per_producer;
+
+            if(item <= last_from_producer[producer])
+            {
+                is_in_order = false;
+            }
+
+            last_from_producer[producer] = item;
+        }
+
+        for(auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK_EQUAL(producers * items_per_producer, count);
+        CHECK(is_in_order);
+        CHECK_EQUAL(queue.pop(item), false);
+
+        int missing_or_duplicate = 0;
+
+        for(int times : received)
+        {
+            if(times != 1)
+            {
+                ++missing_or_duplicate;
+            }
+        }
+
+        CHECK_EQUAL(0, missing_or_duplicate);
+    }
+
+}
+
+
+/**
+ * @brief Test Suit for TimerWheel Class.
+ *        Time is passed in, so the tests don't wait on the clock.
+ * @return
+ */
+SUITE(XRMTimerWheel)
+{
+
+    typedef std::chrono::steady_clock::time_point time_point;
+
+    timer_entry_ptr makeTimer(time_point deadline, std::vector<int> &fired, int id)
+    {
+        return std::make_shared<TimerEntry>(deadline, [&fired, id]()
+        {
+            fired.push_back(id);
+        });
+    }
+
+    TEST(advance_Runs_Timer_Only_When_Due)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(100), fired, 1));
+        CHECK_EQUAL(1u, wheel.size());
+
+        // Never early.
+        CHECK_EQUAL(0, wheel.advance(start + std::chrono::milliseconds(50)));
+        CHECK(fired.empty());
+
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(120)));
+        CHECK_EQUAL(1u, fired.size());
+        CHECK(wheel.is_empty());
+
+        // Only once.
+        CHECK_EQUAL(0, wheel.advance(start + std::chrono::milliseconds(500)));
+        CHECK_EQUAL(1u, fired.size());
+    }
+
+    TEST(advance_Skips_Cancelled_Timer)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        timer_entry_ptr cancelled = makeTimer(start + std::chrono::milliseconds(50), fired, 1);
+        wheel.schedule(cancelled);
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(60), fired, 2));
+        cancelled->cancel();
+
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(100)));
+        CHECK_EQUAL(1u, fired.size());
+        CHECK_EQUAL(2, fired[0]);
+        CHECK(wheel.is_empty());
+
+        // Cancelled before it's scheduled, it's never added.
+        timer_entry_ptr never = makeTimer(start + std::chrono::milliseconds(150), fired, 3);
+        never->cancel();
+        wheel.schedule(never);
+        CHECK(wheel.is_empty());
+    }
+
+    TEST(advance_Releases_Callback_Once_Done)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::shared_ptr<int> captured = std::make_shared<int>(0);
+
+        timer_entry_ptr expired = std::make_shared<TimerEntry>(start + std::chrono::milliseconds(50), [captured]()
+        {
+            ++(*captured);
+        });
+
+        timer_entry_ptr cancelled = std::make_shared<TimerEntry>(start + std::chrono::milliseconds(60), [captured]()
+        {
+            ++(*captured);
+        });
+
+        wheel.schedule(expired);
+        wheel.schedule(cancelled);
+        cancelled->cancel();
+        CHECK_EQUAL(3, captured.use_count());
+
+        // Handles are still held, but not what the callbacks captured.
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(100)));
+        CHECK_EQUAL(1, *captured);
+        CHECK_EQUAL(1, captured.use_count());
+        CHECK(!expired->m_callback);
+        CHECK(!cancelled->m_callback);
+    }
+
+    TEST(advance_Expires_In_Deadline_Order)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(300), fired, 3));
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(100), fired, 1));
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(200), fired, 2));
+
+        CHECK_EQUAL(3, wheel.advance(start + std::chrono::milliseconds(1000)));
+        CHECK_EQUAL(3u, fired.size());
+        CHECK_EQUAL(1, fired[0]);
+        CHECK_EQUAL(2, fired[1]);
+        CHECK_EQUAL(3, fired[2]);
+    }
+
+    TEST(advance_Long_Waits_Over_Many_Turns)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        int turn_milliseconds = TimerWheel::WHEEL_SLOTS * TimerWheel::TICK_MILLISECONDS;
+        int overflow_milliseconds = turn_milliseconds * TimerWheel::OVERFLOW_SLOTS;
+
+        // Same slot of the wheel a turn apart, the overflow level, and past the overflow level.
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(overflow_milliseconds * 2 + 100), fired, 4));
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(turn_milliseconds * 3 + 100), fired, 3));
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(turn_milliseconds + 100), fired, 2));
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(100), fired, 1));
+
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(200)));
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(turn_milliseconds + 200)));
+        CHECK_EQUAL(0, wheel.advance(start + std::chrono::milliseconds(turn_milliseconds * 2 + 200)));
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(turn_milliseconds * 3 + 200)));
+
+        // Passes through the overflow slot once without firing.
+        CHECK_EQUAL(0, wheel.advance(start + std::chrono::milliseconds(overflow_milliseconds + 200)));
+        CHECK_EQUAL(1u, wheel.size());
+
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(overflow_milliseconds * 2 + 200)));
+        CHECK_EQUAL(4u, fired.size());
+        CHECK_EQUAL(1, fired[0]);
+        CHECK_EQUAL(2, fired[1]);
+        CHECK_EQUAL(3, fired[2]);
+        CHECK_EQUAL(4, fired[3]);
+    }
+
+    TEST(millisecondsUntilNext_Follows_Earliest_Timer)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        CHECK_EQUAL(-1, wheel.millisecondsUntilNext(start));
+
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(1000), fired, 1));
+        int wait = wheel.millisecondsUntilNext(start);
+        CHECK(wait >= 1000 && wait <= 1010);
+
+        // An earlier timer replaces the cached one.
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(200), fired, 2));
+        wait = wheel.millisecondsUntilNext(start);
+        CHECK(wait >= 200 && wait <= 210);
+
+        wheel.advance(start + std::chrono::milliseconds(300));
+        wait = wheel.millisecondsUntilNext(start + std::chrono::milliseconds(300));
+        CHECK(wait >= 700 && wait <= 710);
+
+        // Already due.
+        CHECK_EQUAL(0, wheel.millisecondsUntilNext(start + std::chrono::milliseconds(2000)));
+    }
+
+    TEST(millisecondsUntilNext_Follows_Overflow_Timer)
+    {
+        TimerWheel wheel;
+        time_point start = std::chrono::steady_clock::now();
+        std::vector<int> fired;
+
+        int turn_milliseconds = TimerWheel::WHEEL_SLOTS * TimerWheel::TICK_MILLISECONDS;
+
+        // Starts in the overflow level, but is due before a full turn from now.
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(turn_milliseconds + 80), fired, 1));
+
+        wheel.advance(start + std::chrono::milliseconds(1000));
+        int wait = wheel.millisecondsUntilNext(start + std::chrono::milliseconds(1000));
+        CHECK(wait >= turn_milliseconds - 920 && wait <= turn_milliseconds - 910);
+
+        // Cascaded down into the wheel.
+        wheel.advance(start + std::chrono::milliseconds(turn_milliseconds + 10));
+        CHECK(fired.empty());
+        wait = wheel.millisecondsUntilNext(start + std::chrono::milliseconds(turn_milliseconds + 10));
+        CHECK(wait >= 70 && wait <= 80);
+
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(turn_milliseconds * 2 + 100), fired, 2));
+        CHECK_EQUAL(1, wheel.advance(start + std::chrono::milliseconds(turn_milliseconds + 100)));
+        wait = wheel.millisecondsUntilNext(start + std::chrono::milliseconds(turn_milliseconds + 100));
+        CHECK(wait >= turn_milliseconds && wait <= turn_milliseconds + 10);
+
+        // An earlier overflow timer added after the cache was filled.
+        wheel.schedule(makeTimer(start + std::chrono::milliseconds(turn_milliseconds * 2 + 50), fired, 3));
+        wait = wheel.millisecondsUntilNext(start + std::chrono::milliseconds(turn_milliseconds + 100));
+        CHECK(wait >= turn_milliseconds - 50 && wait <= turn_milliseconds - 40);
+    }
+
+}
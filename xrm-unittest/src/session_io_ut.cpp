@@ -5,6 +5,7 @@
 
 #include "io_service.hpp"
 #include "session_io.hpp"
+#include "mci_template.hpp"
 #include "model-sys/config.hpp"
 
 #include <UnitTest++.h>
@@ -943,6 +944,64 @@ SUITE(XRMSessionIO)
         CHECK_EQUAL(code_map[18].m_match, (UINT)7);
     }
 
+    TEST(pipe2genericCodeMap_Test_MapCode_Groups)
+    {
+        session_data_ptr session_data;
+        SessionIO sess(session_data);
+
+        // Test Group 1 ([|]{1}[A-Z]{1}[0-9]{1,2}) and Group 2 ([|]{1}[A-Z]{2})
+        std::string sequence = "|A1 menu |B22|AB1 |0|c1|Q";
+
+        std::vector<MapType> code_map = sess.pipe2genericCodeMap(sequence);
+        CHECK_EQUAL(code_map.size(), (UINT)3);
+
+        // Verify Codes
+        CHECK_EQUAL(code_map[0].m_code, "|A1");
+        CHECK_EQUAL(code_map[1].m_code, "|B22");
+        CHECK_EQUAL(code_map[2].m_code, "|AB");
+
+        // Verify Groups and Offsets
+        CHECK_EQUAL(code_map[0].m_match, (UINT)1);
+        CHECK_EQUAL(code_map[1].m_match, (UINT)1);
+        CHECK_EQUAL(code_map[2].m_match, (UINT)2);
+        CHECK_EQUAL(code_map[1].m_offset, (UINT)9);
+        CHECK_EQUAL(code_map[2].m_offset, (UINT)13);
+    }
+
+    TEST(pipe2promptCodeMap_Test_MapCode_Input_Marker_Only_At_End)
+    {
+        session_data_ptr session_data;
+        SessionIO sess(session_data);
+
+        // Test Group 1 ([\^]{1}[A-Z]{1}) and Group 2 at the end of the prompt
+        std::string sequence = "^A Name: ^z^B:";
+
+        std::vector<MapType> code_map = sess.pipe2promptCodeMap(sequence);
+        CHECK_EQUAL(code_map.size(), (UINT)3);
+
+        CHECK_EQUAL(code_map[0].m_code, "^A");
+        CHECK_EQUAL(code_map[1].m_code, "^B");
+        CHECK_EQUAL(code_map[2].m_code, ":");
+        CHECK_EQUAL(code_map[2].m_match, (UINT)2);
+        CHECK_EQUAL(code_map[2].m_offset, (UINT)13);
+    }
+
+    TEST(pipe2ansi_Test_Template_Fills_Mapped_Codes_And_Keeps_Text)
+    {
+        session_data_ptr session_data;
+        SessionIO sess(session_data);
+
+        // Same template twice, mappings are cleared after each render.
+        std::string sequence = "Hi |UH, welcome!|CR";
+
+        sess.addMCIMapping("|UH", "Bob");
+        CHECK_EQUAL(sess.pipe2ansi(sequence), "Hi Bob, welcome!\r\n");
+        CHECK_EQUAL(sess.getMCIMappingCount(), 0);
+
+        sess.addMCIMapping("|UH", "Alice");
+        CHECK_EQUAL(sess.pipe2ansi(sequence), "Hi Alice, welcome!\r\n");
+    }
+
     // Test Regex Config Field Validations
     TEST(checkRegex_config_regexp_generic_validation_pass)
     {
@@ -1000,6 +1059,38 @@ SUITE(XRMSessionIO)
         CHECK_EQUAL(result, false);
     }
 
+    TEST(checkRegex_Invalid_Expression_Never_Matches)
+    {
+        session_data_ptr session_data;
+        SessionIO sess(session_data);
+
+        // Compiled once, then the same result each time.
+        CHECK_EQUAL(sess.checkRegex("abc", "[abc"), false);
+        CHECK_EQUAL(sess.checkRegex("abc", "[abc"), false);
+        CHECK_EQUAL(sess.checkRegex("abc", "[a-c]+"), true);
+        CHECK_EQUAL(sess.checkRegex("abcd", "[a-c]+"), false);
+    }
+
+    TEST(getTemplate_Keeps_Templates_In_Use_Over_The_Limit)
+    {
+        std::string menu = "|15Main Menu |UH";
+        mci_template_ptr menu_template = MciTemplate::getTemplate(MciTemplate::MCI_STANDARD, menu);
+
+        // Strings with changing values fill the cache, the menu is still in use.
+        for(UINT i = 0; i < MciTemplate::MAX_CACHED_TEMPLATES * 3; i++)
+        {
+            MciTemplate::getTemplate(MciTemplate::MCI_STANDARD, "|07Caller " + std::to_string(i));
+
+            if(i % 100 == 0)
+            {
+                CHECK(MciTemplate::getTemplate(MciTemplate::MCI_STANDARD, menu) == menu_template);
+            }
+        }
+
+        CHECK(MciTemplate::getTemplate(MciTemplate::MCI_STANDARD, menu) == menu_template);
+        CHECK_EQUAL(menu_template->getCodeMap().size(), (UINT)2);
+    }
+
     // \X Match any Unicode combining character sequence, for example "a\x 0301" (a letter a with an acute).
     // Boost is not setup properly for ICU and regex (WINDOWS),  fixme!
     /*